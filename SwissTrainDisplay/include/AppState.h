@@ -12,7 +12,8 @@ enum AppState {
   STATE_WIFI_PASSWORD,     // WiFi password entry
   STATE_PRESET_SELECT,     // Preset selection (NEW - for unlimited presets)
   STATE_PRESET_EDIT,       // Preset editing
-  STATE_ERROR              // Error display (NEW)
+  STATE_ERROR,             // Error display (NEW)
+  STATE_STORAGE_INFO       // Storage usage and wear diagnostics
 };
 
 // ====== MENU IDS ======
@@ -26,7 +27,7 @@ enum MainMenuId {
 
 enum SettingsMenuId {
   SETTINGS_WIFI = 0,
-  SETTINGS_DISPLAY,        // NEW - display settings (future)
+  SETTINGS_DISPLAY,        // Storage diagnostics (StorageScreen)
   SETTINGS_BACK
 };
 
@@ -15,6 +15,8 @@
 #define SCREEN_HEIGHT 64
 #define OLED_RESET -1
 #define SCREEN_ADDRESS 0x3C
+#define I2C_CLOCK_HZ 400000   // Clock used for display flushes
+#define I2C_CHUNK_BYTES 32    // Max bytes per I2C transaction (Wire buffer)
 
 // ====== DISPLAY ZONES (2-color OLED) ======
 // Top 16 pixels are YELLOW
@@ -25,27 +27,98 @@
 
 // ====== TIMING CONSTANTS ======
 #define ENCODER_DEBOUNCE_MS 5
+#define ENCODER_QUEUE_SIZE 32          // ISR event ring buffer (power of two)
+#define ENCODER_SPEED_TIMEOUT_MS 500   // Slower than this counts as stopped
+#define ENCODER_ACCEL_MIN_DPS 8        // Detents/s where acceleration starts
+#define ENCODER_ACCEL_MAX_DPS 40       // Detents/s where it reaches the maximum
+#define ENCODER_ACCEL_MAX_MULTIPLIER 6 // Steps per detent at full speed
 #define BUTTON_DEBOUNCE_MS 50
 #define LONG_PRESS_MS 1000
+#define DOUBLE_PRESS_MS 300            // Max gap between taps of a double press
+#define BUTTON_EDGE_QUEUE_SIZE 32      // ISR edge ring buffer (power of two)
+#define BUTTON_EVENT_QUEUE_SIZE 8      // Debounced gesture queue (power of two)
 #define TRAIN_FETCH_INTERVAL_MS 60000  // 60 seconds
 
+// ====== RENDERING ======
+#define MAX_FPS 20                     // Frame-rate cap for screen redraws
+#define RENDER_STATS_INTERVAL_MS 0     // Periodic render stats (0 = off, use 'stats')
+#define MARQUEE_STEP_MS 40             // Marquee scroll step period
+#define MARQUEE_STEP_PX 1              // Pixels advanced per step
+#define MARQUEE_PAUSE_MS 1500          // Pause at start of each loop
+#define MARQUEE_GAP_PX 24              // Gap before the text repeats
+#define LATENCY_BUCKET_COUNT 8         // Input-to-photon histogram buckets
+
+// ====== TASK SCHEDULER ======
+// Periods / deadlines (max start delay) for the cooperative loop tasks
+#define MAX_SCHEDULER_TASKS 12
+#define TASK_BUTTON_PERIOD_MS 2
+#define TASK_BUTTON_DEADLINE_MS 10
+#define TASK_INPUT_PERIOD_MS 5         // Encoder, screen logic, transitions
+#define TASK_INPUT_DEADLINE_MS 20
+#define TASK_RENDER_PERIOD_MS 5        // Frame rate is capped by MAX_FPS
+#define TASK_RENDER_DEADLINE_MS 50
+#define TASK_FETCH_PERIOD_MS TRAIN_FETCH_INTERVAL_MS
+#define TASK_FETCH_DEADLINE_MS 5000
+#define TASK_NTP_PERIOD_MS 3600000     // Re-sync time hourly
+#define TASK_NTP_DEADLINE_MS 60000
+#define TASK_STORAGE_PERIOD_MS 250     // Flush dirty presets once they settle
+#define PRESET_FLUSH_DELAY_MS 2000     // Quiet time after the last edit before writing
+#define PRESET_FLUSH_MAX_DELAY_MS 10000  // Upper bound while edits keep coming
+#define PRESET_INDEX_SETTLE_MS 5000    // Current preset must be stable this long before saving
+#define PRESET_INDEX_SLOTS 4           // Index writes rotate over this many keys
+#define TASK_STORAGE_DEADLINE_MS 5000
+#define TASK_CONSOLE_PERIOD_MS 20      // Serial diagnostics commands
+#define TASK_CONSOLE_DEADLINE_MS 200
+#define TASK_WIFI_PERIOD_MS 500        // Reconnect supervisor
+#define TASK_WIFI_DEADLINE_MS 2000
+
+// ====== POWER MANAGEMENT ======
+#define POWER_DEFAULT_MODE POWER_MODE_MODEM_SLEEP
+#define POWER_IDLE_TIMEOUT_MS 15000    // No input for this long -> doze
+#define POWER_DOZE_POLL_MS 100         // Input/render polling period while dozing
+#define POWER_SLEEP_SLICE_MS 10        // Re-check for pending input this often
+#define POWER_LISTEN_INTERVAL 3        // DTIM beacons to sleep through in light-sleep
+#define TASK_POWER_PERIOD_MS 250
+#define TASK_POWER_DEADLINE_MS 1000
+
+// ====== SERIAL CONSOLE ======
+#define MAX_CONSOLE_COMMANDS 16
+#define CONSOLE_MAX_LINE 128
+#define SERIAL_RX_BUFFER_BYTES 1024    // Holds console input between polls; import is paced by ACK
+
 // ====== UI CONSTANTS ======
 #define MAX_VISIBLE_MENU_ITEMS 5
 #define CHAR_SELECTOR_VISIBLE_COUNT 5
 #define MENU_ITEM_HEIGHT 10
 #define TITLE_BAR_PADDING 2
+#define TEXT_METRICS_CACHE_SIZE 16  // Memoized text widths (labels, titles)
 
 // ====== CHARACTER SET FOR INPUT ======
-const char KEYBOARD_CHARS[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 !@#$%&*()-_=+[]{};:,.<>?";
+// Flash-resident (PROGMEM) - read characters with charsetAt(), never index directly
+static const char KEYBOARD_CHARS[] PROGMEM = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 !@#$%&*()-_=+[]{};:,.<>?";
 const int KEYBOARD_CHARS_COUNT = sizeof(KEYBOARD_CHARS) - 1; // -1 for null terminator
 
 // Station name character set (lowercase letters only, auto-capitalize)
-const char STATION_CHARS[] = "abcdefghijklmnopqrstuvwxyz ";
+static const char STATION_CHARS[] PROGMEM = "abcdefghijklmnopqrstuvwxyz ";
 const int STATION_CHARS_COUNT = sizeof(STATION_CHARS) - 1;
 
+inline char charsetAt(PGM_P charset, int index) {
+  return (char)pgm_read_byte(charset + index);
+}
+
+// ====== STATION COMPLETION ======
+// Station names come from the flash index in lib/Data/StationIndex.h
+#define STATION_COMPLETE_MIN_CHARS 2    // Typed characters before suggesting a station
+
 // ====== NETWORK SETTINGS ======
 #define WIFI_CONNECT_TIMEOUT_MS 10000  // 10 seconds
 #define WIFI_SCAN_MAX_NETWORKS 20
+#define WIFI_SCAN_TIMEOUT_MS 15000         // Give up on an async scan after this
+#define WIFI_SCAN_EXPECTED_MS 2500         // Typical all-channel scan, for the progress bar
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 3000  // Cached BSSID/channel attempt before full scan
+#define WIFI_REUSE_DHCP_LEASE 1            // Reapply the last lease instead of running DHCP
+#define WIFI_RECONNECT_MIN_MS 2000         // First retry after a link loss
+#define WIFI_RECONNECT_MAX_MS 300000       // Backoff ceiling (5 minutes)
 #define API_BASE_URL "http://transport.opendata.ch/v1"
 
 // ====== NTP SETTINGS ======
@@ -59,7 +132,50 @@ const int STATION_CHARS_COUNT = sizeof(STATION_CHARS) - 1;
 #define PREFS_KEY_SSID "ssid"
 #define PREFS_KEY_PASSWORD "password"
 #define PREFS_KEY_PRESET_COUNT "presetCount"
-#define PREFS_KEY_CURRENT_PRESET "currentPreset"
+#define PREFS_KEY_CURRENT_PRESET "currentPreset"  // Legacy single-slot index
+#define PREFS_KEY_CURRENT_SLOT_PREFIX "curIdx"   // Rotating index slots curIdx0..N-1
 #define PREFS_KEY_PRESET_PREFIX "preset_"
+#define PREFS_KEY_WIFI_FAST "wifiFast"
+#define PREFS_KEY_PRESET_TABLE "presetTable"  // Pre-journal binary table, migrated on load
+#define PREFS_KEY_WEAR_STATS "wearStats"      // Lifetime storage write counters
+
+// ====== DEFAULT PRESETS ======
+// Presets created on first boot, chosen per deployment site at compile
+// time (build_flags = -DDEFAULT_PRESET_SITE=PRESET_SITE_ZURICH).
+// Tables live in flash, see include/DefaultPresets.h
+#define PRESET_SITE_LAUSANNE 0
+#define PRESET_SITE_GENEVA 1
+#define PRESET_SITE_BERN 2
+#define PRESET_SITE_ZURICH 3
+#ifndef DEFAULT_PRESET_SITE
+#define DEFAULT_PRESET_SITE PRESET_SITE_LAUSANNE
+#endif
+
+// ====== PRESET TABLE FORMAT ======
+#define PRESET_TABLE_MAGIC 0x50445453UL  // "STDP" little-endian
+#define PRESET_TABLE_VERSION 1
+#define PRESET_TABLE_MAX_BYTES 8192      // Largest table written or accepted on load (~100 presets)
+#define PRESET_CACHE_SIZE 4              // Fully loaded presets kept in RAM (LRU)
+
+// ====== SETTINGS IMAGE (serial export/import) ======
+#define SETTINGS_IMAGE_MAGIC 0x49445453UL  // "STDI" little-endian
+#define SETTINGS_IMAGE_VERSION 1
+#define SETTINGS_IMAGE_CHUNK_BYTES 72      // Body bytes per base64 line (96 chars)
+#define SETTINGS_IMAGE_TIMEOUT_MS 5000     // Abort an import stalled this long
+
+// ====== PRESET JOURNAL (LittleFS) ======
+#define PRESET_JOURNAL_PATH "/presets.jnl"
+#define PRESET_JOURNAL_COMPACT_BYTES 8192  // Rewrite as one snapshot past this size
+
+// ====== STORAGE COMPACTION ======
+#define STORAGE_COMPACT_FREE_BYTES 12288   // Compact automatically below this much free LittleFS space
+#define STORAGE_CHECK_INTERVAL_MS 60000    // How often the storage task looks at free space
+#define LEGACY_KEY_SCAN_GAP 8              // Stop probing preset_N_* after this many empty indices
+
+// ====== STORAGE TELEMETRY ======
+#define STORAGE_WEAR_SAVE_MS 3600000UL     // Persist lifetime write counters at most hourly
+#define STORAGE_WRITE_OVERHEAD_BYTES 64    // LittleFS metadata cost assumed per write
+#define STORAGE_FLASH_ENDURANCE 100000     // Rated erase cycles per sector
+#define STORAGE_SCREEN_REFRESH_MS 2000
 
 #endif // CONFIG_H
@@ -0,0 +1,53 @@
+#ifndef DEFAULTPRESETS_H
+#define DEFAULTPRESETS_H
+
+#include <Arduino.h>
+#include "Config.h"
+#include "Types.h"
+
+// ====== DEFAULT PRESET TABLES ======
+// Fixed-size records in PROGMEM so nothing is copied to RAM until the
+// defaults are actually needed. Copy an entry out with readDefaultPreset().
+
+#define DEFAULT_PRESET_TEXT_LEN 20
+
+struct DefaultPresetEntry {
+  char name[DEFAULT_PRESET_TEXT_LEN];
+  char from[DEFAULT_PRESET_TEXT_LEN];
+  char to[DEFAULT_PRESET_TEXT_LEN];
+  uint8_t type;
+};
+
+static const DefaultPresetEntry DEFAULT_PRESETS[] PROGMEM = {
+#if DEFAULT_PRESET_SITE == PRESET_SITE_LAUSANNE
+  {"Lausanne-Geneva", "Lausanne", "Geneve", PRESET_TRAIN},
+  {"Lausanne-Bern", "Lausanne", "Bern", PRESET_TRAIN},
+  {"Lausanne-Zurich", "Lausanne", "Zurich", PRESET_TRAIN},
+#elif DEFAULT_PRESET_SITE == PRESET_SITE_GENEVA
+  {"Geneva-Lausanne", "Geneve", "Lausanne", PRESET_TRAIN},
+  {"Geneva-Airport", "Geneve", "Geneve Aeroport", PRESET_TRAIN},
+  {"Geneva-Bern", "Geneve", "Bern", PRESET_TRAIN},
+#elif DEFAULT_PRESET_SITE == PRESET_SITE_BERN
+  {"Bern-Zurich", "Bern", "Zurich", PRESET_TRAIN},
+  {"Bern-Thun", "Bern", "Thun", PRESET_TRAIN},
+  {"Bern-Basel", "Bern", "Basel", PRESET_TRAIN},
+#elif DEFAULT_PRESET_SITE == PRESET_SITE_ZURICH
+  {"Zurich-Bern", "Zurich", "Bern", PRESET_TRAIN},
+  {"Zurich-Basel", "Zurich", "Basel", PRESET_TRAIN},
+  {"Zurich-Airport", "Zurich", "Zurich Flughafen", PRESET_TRAIN},
+#else
+#error "Unknown DEFAULT_PRESET_SITE"
+#endif
+  {"Clock", "", "", PRESET_CLOCK},
+};
+
+const int DEFAULT_PRESET_COUNT = sizeof(DEFAULT_PRESETS) / sizeof(DEFAULT_PRESETS[0]);
+
+inline void readDefaultPreset(int index, Preset& preset) {
+  DefaultPresetEntry entry;
+  memcpy_P(&entry, &DEFAULT_PRESETS[index], sizeof(entry));
+  preset = Preset(entry.name, entry.from, entry.to);
+  preset.type = (PresetType)entry.type;
+}
+
+#endif // DEFAULTPRESETS_H
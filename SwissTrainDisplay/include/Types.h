@@ -2,6 +2,7 @@
 #define TYPES_H
 
 #include <Arduino.h>
+#include "Config.h"
 
 // ====== PRESET TYPES ======
 
@@ -12,6 +13,17 @@ enum PresetType {
   PRESET_CALENDAR   // Calendar display (future)
 };
 
+// Per-field dirty bits for incremental persistence
+enum PresetField {
+  PRESET_FIELD_NAME    = 0x01,
+  PRESET_FIELD_TYPE    = 0x02,
+  PRESET_FIELD_FROM    = 0x04,
+  PRESET_FIELD_TO      = 0x08,
+  PRESET_FIELD_ENABLED = 0x10,
+  PRESET_FIELD_TRAINS  = 0x20,
+  PRESET_FIELD_ALL     = 0x3F
+};
+
 struct Preset {
   String name;           // Display name
   PresetType type;       // Type of preset
@@ -30,6 +42,17 @@ struct Preset {
     : name(n), type(t), fromStation(""), toStation(""), enabled(true), trainsToDisplay(1) {}
 };
 
+// Resident index entry; station details stay in storage until needed
+struct PresetSummary {
+  String label;            // Display name (from->to for unnamed train presets)
+  PresetType type;
+  bool enabled;
+  uint8_t trainsToDisplay;
+  int16_t stored;          // Storage slot of the full record (-1 = not written yet)
+
+  PresetSummary() : label(""), type(PRESET_TRAIN), enabled(true), trainsToDisplay(1), stored(-1) {}
+};
+
 // ====== TRAIN DATA TYPES ======
 
 struct TrainConnection {
@@ -59,16 +82,50 @@ struct TrainConnection {
 enum ButtonEvent {
   BUTTON_NONE,
   BUTTON_SHORT_PRESS,
-  BUTTON_LONG_PRESS
+  BUTTON_LONG_PRESS,
+  BUTTON_DOUBLE_PRESS     // Second short press shortly after a first one
+};
+
+// Debounced button gesture with the time of its press edge
+struct ButtonPressEvent {
+  ButtonEvent type;
+  unsigned long pressTime;  // micros() of the debounced press edge
+  unsigned long duration;   // Press duration in microseconds (0 while held)
+
+  ButtonPressEvent() : type(BUTTON_NONE), pressTime(0), duration(0) {}
+  ButtonPressEvent(ButtonEvent t, unsigned long p, unsigned long d) : type(t), pressTime(p), duration(d) {}
+};
+
+// Raw pin edge captured by the button ISR
+struct ButtonEdge {
+  uint8_t level;            // Pin level read in the ISR
+  unsigned long timestamp;  // micros()
+
+  ButtonEdge() : level(HIGH), timestamp(0) {}
+  ButtonEdge(uint8_t l, unsigned long t) : level(l), timestamp(t) {}
 };
 
 struct EncoderEvent {
-  int delta;              // Change in position
-  int position;           // Absolute position
-  unsigned long timestamp; // When event occurred
+  int8_t delta;           // Detents moved (+1 clockwise, -1 counter-clockwise)
+  int position;           // Absolute position after the move
+  unsigned long timestamp; // micros() when the detent was registered
 
   EncoderEvent() : delta(0), position(0), timestamp(0) {}
-  EncoderEvent(int d, int p) : delta(d), position(p), timestamp(millis()) {}
+  EncoderEvent(int d, int p, unsigned long t) : delta(d), position(p), timestamp(t) {}
+};
+
+// Velocity-to-step curve for encoder acceleration: below minDps each
+// detent is one step, rising linearly to maxMultiplier steps at maxDps
+struct AccelerationCurve {
+  uint16_t minDps;
+  uint16_t maxDps;
+  uint8_t maxMultiplier;
+
+  AccelerationCurve()
+    : minDps(ENCODER_ACCEL_MIN_DPS), maxDps(ENCODER_ACCEL_MAX_DPS),
+      maxMultiplier(ENCODER_ACCEL_MAX_MULTIPLIER) {}
+  AccelerationCurve(uint16_t minSpeed, uint16_t maxSpeed, uint8_t multiplier)
+    : minDps(minSpeed), maxDps(maxSpeed), maxMultiplier(multiplier) {}
 };
 
 // ====== ERROR TYPES ======
@@ -97,6 +154,45 @@ struct ErrorInfo {
 
 // ====== WIFI TYPES ======
 
+// Radio/CPU power policy between refreshes
+enum PowerMode {
+  POWER_MODE_ALWAYS_ON,     // No sleep, lowest latency
+  POWER_MODE_MODEM_SLEEP,   // Radio sleeps between beacons, CPU idles in delay()
+  POWER_MODE_LIGHT_SLEEP    // Radio and CPU sleep while dozing, GPIO wakes
+};
+
+// Last good association, used to skip the scan and DHCP on reconnect
+struct WiFiFastConnect {
+  uint32_t ssidHash;     // Data only applies to the SSID it was captured for
+  uint8_t bssid[6];
+  int32_t channel;       // 0 = unknown
+  uint32_t ip;           // 0 = use DHCP
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  bool staticIP;         // Addresses are user-configured, not a cached lease
+
+  WiFiFastConnect() : ssidHash(0), channel(0), ip(0), gateway(0), subnet(0), dns(0), staticIP(false) {
+    memset(bssid, 0, sizeof(bssid));
+  }
+  bool hasAssociation() const { return channel > 0; }
+  bool hasAddress() const { return ip != 0 && gateway != 0 && subnet != 0; }
+  bool operator==(const WiFiFastConnect& o) const {
+    return ssidHash == o.ssidHash && memcmp(bssid, o.bssid, sizeof(bssid)) == 0 &&
+           channel == o.channel && ip == o.ip && gateway == o.gateway &&
+           subnet == o.subnet && dns == o.dns && staticIP == o.staticIP;
+  }
+};
+
+// Non-blocking connection progress (polled by StateMachine)
+enum WiFiConnectState {
+  WIFI_STATE_IDLE,         // Nothing in progress
+  WIFI_STATE_CONNECTING,   // WiFi.begin() issued, waiting for an IP
+  WIFI_STATE_CONNECTED,    // Got IP
+  WIFI_STATE_FAILED,       // Timed out or rejected
+  WIFI_STATE_CANCELLED     // Aborted by the user
+};
+
 struct WiFiNetwork {
   String ssid;
   int rssi;              // Signal strength
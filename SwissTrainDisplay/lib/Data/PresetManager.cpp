@@ -1,7 +1,11 @@
 #include "PresetManager.h"
+#include "../../include/DefaultPresets.h"
+#include <algorithm>
 
 PresetManager::PresetManager(SettingsManager* settingsManager)
-  : currentPresetIndex(0), settings(settingsManager), isDirty(false) {
+  : cacheHits(0), cacheMisses(0), currentPresetIndex(0), settings(settingsManager), tableDirty(false), persistedIndex(-1),
+    indexChangedAt(0), indexWrites(0),
+    firstDirtyAt(0), lastDirtyAt(0), flushCount(0), skippedWrites(0), legacyKeysPending(0) {
 }
 
 // ====== INITIALIZATION ======
@@ -9,19 +13,26 @@ PresetManager::PresetManager(SettingsManager* settingsManager)
 void PresetManager::initializeDefaults() {
   Serial.println("Initializing default presets");
 
-  presets.clear();
-
-  // Default train routes
-  presets.push_back(Preset("Lausanne-Geneva", "Lausanne", "Geneve"));
-  presets.push_back(Preset("Lausanne-Bern", "Lausanne", "Bern"));
-  presets.push_back(Preset("Lausanne-Zurich", "Lausanne", "Zurich"));
-
-  // Default clock
-  Preset clockPreset("Clock", PRESET_CLOCK);
-  presets.push_back(clockPreset);
+  // Site routes plus a clock, copied out of flash (DEFAULT_PRESET_SITE)
+  std::vector<Preset> defaults(DEFAULT_PRESET_COUNT);
+  for (int i = 0; i < DEFAULT_PRESET_COUNT; i++) {
+    readDefaultPreset(i, defaults[i]);
+  }
 
+  adopt(defaults);
   currentPresetIndex = 0;
-  isDirty = true;
+}
+
+void PresetManager::adopt(const std::vector<Preset>& all) {
+  // Everything starts unsaved, so all of it stays cached until the next flush
+  summaries.clear();
+  cache.clear();
+  for (size_t i = 0; i < all.size(); i++) {
+    summaries.push_back(summarize(all[i], -1));
+    cache.push_back({(int)i, all[i]});
+  }
+  dirtyFields.assign(all.size(), PRESET_FIELD_ALL);
+  markTableDirty();
 }
 
 // ====== LOAD/SAVE ======
@@ -33,34 +44,73 @@ bool PresetManager::loadAll() {
     return false;
   }
 
-  int count = settings->getPresetCount();
+  bool migrated = false;
+  bool saved = true;
+  if (settings->loadPresetIndex(summaries)) {
+    cache.clear();
+    Serial.printf("Preset index loaded: %d presets\n", summaries.size());
+  } else if (settings->getPresetCount() > 0) {
+    // Older firmware stored six keys per preset - convert once
+    saved = migrateLegacy();
+    migrated = true;
+  } else {
+    if (settings->hasPresetTable()) {
+      Serial.println("WARNING: Preset table unreadable, restoring defaults");
+    } else {
+      Serial.println("No presets found, initializing defaults");
+    }
+    initializeDefaults();
+    return saveAll();
+  }
 
-  if (count == 0) {
-    Serial.println("No presets found, initializing defaults");
+  if (summaries.empty()) {
     initializeDefaults();
     return saveAll();
   }
 
-  Serial.printf("Loading %d presets\n", count);
-  presets.clear();
+  // Load current preset index
+  currentPresetIndex = settings->loadCurrentPreset();
+  if (currentPresetIndex >= (int)summaries.size()) {
+    currentPresetIndex = 0;
+  }
+
+  // A migration that could not be written yet stays dirty for flushIfDue()
+  if (!migrated) {
+    dirtyFields.assign(summaries.size(), 0);
+    persistedIndex = currentPresetIndex;
+    markClean();
+  }
+  Serial.printf("Loaded %d presets, current: %d\n", summaries.size(), currentPresetIndex);
+  return saved;
+}
+
+bool PresetManager::migrateLegacy() {
+  int count = settings->getPresetCount();
+  Serial.printf("Migrating %d presets from legacy keys\n", count);
 
+  std::vector<Preset> loaded;
   for (int i = 0; i < count; i++) {
     Preset preset;
     if (settings->loadPreset(i, preset)) {
-      presets.push_back(preset);
+      loaded.push_back(preset);
     } else {
       Serial.printf("WARNING: Failed to load preset %d\n", i);
     }
   }
+  adopt(loaded);
 
-  // Load current preset index
+  // flush() persists the index and retires the old currentPreset key, so carry it over first
   currentPresetIndex = settings->loadCurrentPreset();
-  if (currentPresetIndex >= (int)presets.size()) {
+  if (currentPresetIndex >= (int)summaries.size()) {
     currentPresetIndex = 0;
   }
 
-  isDirty = false;
-  Serial.printf("Loaded %d presets, current: %d\n", presets.size(), currentPresetIndex);
+  // Only drop the old keys once the table is safely written (see flush)
+  legacyKeysPending = count;
+  if (!flush()) {
+    Serial.println("ERROR: Migration not saved yet, keeping legacy keys until a flush succeeds");
+    return false;
+  }
   return true;
 }
 
@@ -70,45 +120,175 @@ bool PresetManager::saveAll() {
     return false;
   }
 
-  Serial.printf("Saving %d presets\n", presets.size());
+  Serial.printf("Saving %d presets\n", summaries.size());
 
-  // Save preset count
-  if (!settings->setPresetCount(presets.size())) {
-    Serial.println("ERROR: Failed to save preset count");
+  // A full snapshot, then the current index
+  markTableDirty();
+  persistedIndex = -1;
+  if (!flush()) {
     return false;
   }
 
-  // Save each preset
-  for (size_t i = 0; i < presets.size(); i++) {
-    if (!settings->savePreset(i, presets[i])) {
-      Serial.printf("ERROR: Failed to save preset %d\n", i);
-      return false;
+  Serial.println("All presets saved successfully");
+  return true;
+}
+
+bool PresetManager::save(int index) {
+  if (!isValidIndex(index)) {
+    Serial.println("ERROR: Invalid preset index");
+    return false;
+  }
+
+  // The table is one blob, so saving one preset is a flush
+  return flush();
+}
+
+// ====== DIRTY TRACKING ======
+
+void PresetManager::markDirty(int index, uint8_t fields) {
+  if (index >= 0 && index < (int)dirtyFields.size()) {
+    dirtyFields[index] |= fields;
+  }
+
+  unsigned long now = millis();
+  if (firstDirtyAt == 0) {
+    firstDirtyAt = now ? now : 1;
+  }
+  lastDirtyAt = now;
+}
+
+void PresetManager::markTableDirty() {
+  tableDirty = true;
+  markDirty(-1, 0);
+}
+
+void PresetManager::markClean() {
+  std::fill(dirtyFields.begin(), dirtyFields.end(), 0);
+  tableDirty = false;
+  firstDirtyAt = 0;
+}
+
+uint8_t PresetManager::diffFields(const Preset& a, const Preset& b) {
+  uint8_t fields = 0;
+  if (a.name != b.name) fields |= PRESET_FIELD_NAME;
+  if (a.type != b.type) fields |= PRESET_FIELD_TYPE;
+  if (a.fromStation != b.fromStation) fields |= PRESET_FIELD_FROM;
+  if (a.toStation != b.toStation) fields |= PRESET_FIELD_TO;
+  if (a.enabled != b.enabled) fields |= PRESET_FIELD_ENABLED;
+  if (a.trainsToDisplay != b.trainsToDisplay) fields |= PRESET_FIELD_TRAINS;
+  return fields;
+}
+
+bool PresetManager::hasDirtyFlag() const {
+  if (tableDirty) {
+    return true;
+  }
+  for (uint8_t fields : dirtyFields) {
+    if (fields) {
+      return true;
     }
   }
+  return false;
+}
 
-  // Save current preset index
+uint8_t PresetManager::getDirtyFields(int index) const {
+  if (index < 0 || index >= (int)dirtyFields.size()) {
+    return 0;
+  }
+  return dirtyFields[index];
+}
+
+void PresetManager::noteIndexChange() {
+  indexChangedAt = millis();
+}
+
+bool PresetManager::persistIndex() {
+  if (currentPresetIndex == persistedIndex) {
+    return true;
+  }
   if (!settings->saveCurrentPreset(currentPresetIndex)) {
-    Serial.println("ERROR: Failed to save current preset index");
     return false;
   }
-
-  isDirty = false;
-  Serial.println("All presets saved successfully");
+  persistedIndex = currentPresetIndex;
+  indexWrites++;
+  Serial.printf("Current preset %d saved (slot %d)\n", currentPresetIndex, settings->getCurrentPresetSlot());
   return true;
 }
 
-bool PresetManager::save(int index) {
-  if (!isValidIndex(index)) {
-    Serial.println("ERROR: Invalid preset index");
-    return false;
+bool PresetManager::flushIfDue() {
+  unsigned long now = millis();
+
+  if (hasDirtyFlag()) {
+    // Wait for the edit burst to settle, but don't hold changes forever
+    if (now - lastDirtyAt < PRESET_FLUSH_DELAY_MS && now - firstDirtyAt < PRESET_FLUSH_MAX_DELAY_MS) {
+      return false;
+    }
+    return flush();
   }
 
+  // Scrolling through presets only saves where the user settles
+  if (currentPresetIndex != persistedIndex && now - indexChangedAt >= PRESET_INDEX_SETTLE_MS) {
+    return persistIndex();
+  }
+  return false;
+}
+
+bool PresetManager::flush() {
   if (!settings || !settings->isInitialized()) {
     Serial.println("ERROR: SettingsManager not initialized");
     return false;
   }
 
-  return settings->savePreset(index, presets[index]);
+  if (hasDirtyFlag()) {
+    int dirtyRecords = 0;
+    for (uint8_t fields : dirtyFields) {
+      if (fields) {
+        dirtyRecords++;
+      }
+    }
+    Serial.printf("Flushing presets: %d changed record(s)%s\n",
+                  dirtyRecords, tableDirty ? ", table layout changed" : "");
+
+    // Field edits journal just the touched records; structural changes a snapshot.
+    // Dirty presets are pinned, so everything to write is in the cache. Clean
+    // entries are carried over byte-for-byte: one may be hydrate()'s fallback.
+    bool saved;
+    if (tableDirty) {
+      std::vector<const Preset*> hydrated(summaries.size(), nullptr);
+      for (const CachedPreset& entry : cache) {
+        if (isPinned(entry.index)) {
+          hydrated[entry.index] = &entry.preset;
+        }
+      }
+      saved = settings->savePresetTable(summaries, hydrated);
+      if (saved) {
+        for (size_t i = 0; i < summaries.size(); i++) {
+          summaries[i].stored = i;
+        }
+      }
+    } else {
+      std::vector<std::pair<int, const Preset*>> records;
+      for (const CachedPreset& entry : cache) {
+        if (dirtyFields[entry.index]) {
+          records.push_back(std::make_pair(entry.index, &entry.preset));
+        }
+      }
+      saved = settings->savePresetRecords(records, summaries.size());
+    }
+    if (!saved) {
+      return false;  // Stay dirty; the storage task retries
+    }
+    flushCount++;
+    markClean();
+    trimCache();
+
+    if (legacyKeysPending > 0) {
+      settings->removeLegacyPresets(legacyKeysPending);
+      legacyKeysPending = 0;
+    }
+  }
+
+  return persistIndex();
 }
 
 // ====== PRESET OPERATIONS ======
@@ -119,10 +299,19 @@ bool PresetManager::addPreset(const Preset& preset) {
     return false;
   }
 
-  presets.push_back(preset);
-  isDirty = true;
+  // Recovery rejects larger tables, so never grow past what can be loaded
+  if (getTableBytes() + PresetCodec::recordSize(preset) > PRESET_TABLE_MAX_BYTES) {
+    Serial.println("ERROR: Preset table full, preset not added");
+    return false;
+  }
+
+  summaries.push_back(summarize(preset, -1));
+  dirtyFields.push_back(PRESET_FIELD_ALL);
+  cache.push_front({(int)summaries.size() - 1, preset});
+  markTableDirty();
+  trimCache();
 
-  Serial.printf("Preset added: %s (total: %d)\n", preset.name.c_str(), presets.size());
+  Serial.printf("Preset added: %s (total: %d)\n", preset.name.c_str(), summaries.size());
   return true;
 }
 
@@ -137,8 +326,29 @@ bool PresetManager::updatePreset(int index, const Preset& preset) {
     return false;
   }
 
-  presets[index] = preset;
-  isDirty = true;
+  Preset* stored = hydrate(index);
+
+  // Only fields that actually changed count; a no-op edit writes nothing
+  uint8_t changed = diffFields(*stored, preset);
+  if (changed == 0) {
+    skippedWrites++;
+    Serial.printf("Preset %d unchanged, nothing to save\n", index);
+    return true;
+  }
+
+  // getTableBytes() counts a clean preset by its stored record, not the cached copy
+  size_t oldBytes = PresetCodec::recordSize(*stored);
+  if (!isPinned(index) && settings) {
+    oldBytes = settings->getPresetJournal().getRecordLength(summaries[index].stored);
+  }
+  if (getTableBytes() - oldBytes + PresetCodec::recordSize(preset) > PRESET_TABLE_MAX_BYTES) {
+    Serial.println("ERROR: Preset table full, edit not saved");
+    return false;
+  }
+
+  *stored = preset;
+  summaries[index] = summarize(preset, summaries[index].stored);
+  markDirty(index, changed);
 
   Serial.printf("Preset %d updated: %s\n", index, preset.name.c_str());
   return true;
@@ -151,46 +361,135 @@ bool PresetManager::deletePreset(int index) {
   }
 
   // Don't allow deleting the last preset
-  if (presets.size() <= 1) {
+  if (summaries.size() <= 1) {
     Serial.println("ERROR: Cannot delete last preset");
     return false;
   }
 
-  String name = presets[index].name;
-  presets.erase(presets.begin() + index);
-  isDirty = true;
+  String name = summaries[index].label;
+  summaries.erase(summaries.begin() + index);
+  dirtyFields.erase(dirtyFields.begin() + index);
+
+  // Cached entries follow their presets down one slot
+  for (auto it = cache.begin(); it != cache.end();) {
+    if (it->index == index) {
+      it = cache.erase(it);
+      continue;
+    }
+    if (it->index > index) {
+      it->index--;
+    }
+    ++it;
+  }
+  markTableDirty();
 
   // Adjust current index if needed
-  if (currentPresetIndex >= (int)presets.size()) {
-    currentPresetIndex = presets.size() - 1;
+  if (currentPresetIndex >= (int)summaries.size()) {
+    currentPresetIndex = summaries.size() - 1;
+    noteIndexChange();
   }
 
-  Serial.printf("Preset deleted: %s (remaining: %d)\n", name.c_str(), presets.size());
+  Serial.printf("Preset deleted: %s (remaining: %d)\n", name.c_str(), summaries.size());
   return true;
 }
 
 Preset* PresetManager::getPreset(int index) {
+  return hydrate(index);
+}
+
+const PresetSummary* PresetManager::getSummary(int index) const {
   if (!isValidIndex(index)) {
     return nullptr;
   }
-  return &presets[index];
+  return &summaries[index];
 }
 
-const Preset* PresetManager::getPreset(int index) const {
+// ====== LAZY LOADING ======
+
+PresetSummary PresetManager::summarize(const Preset& preset, int16_t stored) {
+  PresetSummary summary;
+  summary.label = getDisplayName(preset);
+  summary.type = preset.type;
+  summary.enabled = preset.enabled;
+  summary.trainsToDisplay = preset.trainsToDisplay;
+  summary.stored = stored;
+  return summary;
+}
+
+Preset* PresetManager::hydrate(int index) {
   if (!isValidIndex(index)) {
     return nullptr;
   }
-  return &presets[index];
+
+  for (auto it = cache.begin(); it != cache.end(); ++it) {
+    if (it->index == index) {
+      cache.splice(cache.begin(), cache, it);
+      cacheHits++;
+      return &cache.front().preset;
+    }
+  }
+
+  cacheMisses++;
+  CachedPreset entry;
+  entry.index = index;
+  const PresetSummary& summary = summaries[index];
+  if (summary.stored < 0 || !settings || !settings->loadPresetRecord(summary.stored, entry.preset)) {
+    // Keep the UI usable with what the index knows
+    Serial.printf("ERROR: Details of preset %d unavailable\n", index);
+    entry.preset.name = summary.label;
+    entry.preset.type = summary.type;
+    entry.preset.enabled = summary.enabled;
+    entry.preset.trainsToDisplay = summary.trainsToDisplay;
+  }
+
+  cache.push_front(entry);
+  trimCache();
+  return &cache.front().preset;
+}
+
+size_t PresetManager::getTableBytes() {
+  // Pinned copies hold unsaved edits; the rest are written as stored (see flush)
+  std::vector<bool> counted(summaries.size(), false);
+  size_t bytes = PRESET_TABLE_HEADER_SIZE;
+  for (const CachedPreset& entry : cache) {
+    if (isPinned(entry.index)) {
+      bytes += PresetCodec::recordSize(entry.preset);
+      counted[entry.index] = true;
+    }
+  }
+  if (settings) {
+    PresetJournal& journal = settings->getPresetJournal();
+    for (size_t i = 0; i < summaries.size(); i++) {
+      if (!counted[i]) {
+        bytes += journal.getRecordLength(summaries[i].stored);
+      }
+    }
+  }
+  return bytes;
 }
 
-// ====== NAVIGATION ======
+bool PresetManager::isPinned(int index) const {
+  return summaries[index].stored < 0 || dirtyFields[index] != 0;
+}
 
-Preset* PresetManager::getCurrent() {
-  return getPreset(currentPresetIndex);
+void PresetManager::trimCache() {
+  // Evict clean entries from the cold end; the front is the one in use
+  auto it = cache.end();
+  while (cache.size() > PRESET_CACHE_SIZE && it != cache.begin()) {
+    --it;
+    if (it == cache.begin()) {
+      break;
+    }
+    if (!isPinned(it->index)) {
+      it = cache.erase(it);
+    }
+  }
 }
 
-const Preset* PresetManager::getCurrent() const {
-  return getPreset(currentPresetIndex);
+// ====== NAVIGATION ======
+
+Preset* PresetManager::getCurrent() {
+  return hydrate(currentPresetIndex);
 }
 
 bool PresetManager::setCurrentIndex(int index) {
@@ -199,36 +498,39 @@ bool PresetManager::setCurrentIndex(int index) {
   }
 
   currentPresetIndex = index;
-  Serial.printf("Current preset: %d (%s)\n", index, presets[index].name.c_str());
+  noteIndexChange();
+  Serial.printf("Current preset: %d (%s)\n", index, summaries[index].label.c_str());
   return true;
 }
 
 bool PresetManager::next() {
-  if (presets.empty()) {
+  if (summaries.empty()) {
     return false;
   }
 
-  currentPresetIndex = (currentPresetIndex + 1) % presets.size();
-  Serial.printf("Next preset: %d (%s)\n", currentPresetIndex, presets[currentPresetIndex].name.c_str());
+  currentPresetIndex = (currentPresetIndex + 1) % summaries.size();
+  noteIndexChange();
+  Serial.printf("Next preset: %d (%s)\n", currentPresetIndex, summaries[currentPresetIndex].label.c_str());
   return true;
 }
 
 bool PresetManager::previous() {
-  if (presets.empty()) {
+  if (summaries.empty()) {
     return false;
   }
 
   currentPresetIndex--;
   if (currentPresetIndex < 0) {
-    currentPresetIndex = presets.size() - 1;
+    currentPresetIndex = summaries.size() - 1;
   }
+  noteIndexChange();
 
-  Serial.printf("Previous preset: %d (%s)\n", currentPresetIndex, presets[currentPresetIndex].name.c_str());
+  Serial.printf("Previous preset: %d (%s)\n", currentPresetIndex, summaries[currentPresetIndex].label.c_str());
   return true;
 }
 
 bool PresetManager::nextEnabled() {
-  if (presets.empty()) {
+  if (summaries.empty()) {
     return false;
   }
 
@@ -236,18 +538,19 @@ bool PresetManager::nextEnabled() {
   int attempts = 0;
 
   do {
-    currentPresetIndex = (currentPresetIndex + 1) % presets.size();
+    currentPresetIndex = (currentPresetIndex + 1) % summaries.size();
     attempts++;
 
     // If we've checked all presets and none are enabled, stay on current
-    if (attempts > (int)presets.size()) {
+    if (attempts > (int)summaries.size()) {
       Serial.println("WARNING: No enabled presets found");
       return false;
     }
 
     // If current preset is enabled, we're done
-    if (presets[currentPresetIndex].enabled) {
-      Serial.printf("Next enabled preset: %d (%s)\n", currentPresetIndex, presets[currentPresetIndex].name.c_str());
+    if (summaries[currentPresetIndex].enabled) {
+      noteIndexChange();
+      Serial.printf("Next enabled preset: %d (%s)\n", currentPresetIndex, summaries[currentPresetIndex].label.c_str());
       return true;
     }
   } while (currentPresetIndex != startIndex);
@@ -257,7 +560,7 @@ bool PresetManager::nextEnabled() {
 }
 
 bool PresetManager::previousEnabled() {
-  if (presets.empty()) {
+  if (summaries.empty()) {
     return false;
   }
 
@@ -267,19 +570,20 @@ bool PresetManager::previousEnabled() {
   do {
     currentPresetIndex--;
     if (currentPresetIndex < 0) {
-      currentPresetIndex = presets.size() - 1;
+      currentPresetIndex = summaries.size() - 1;
     }
     attempts++;
 
     // If we've checked all presets and none are enabled, stay on current
-    if (attempts > (int)presets.size()) {
+    if (attempts > (int)summaries.size()) {
       Serial.println("WARNING: No enabled presets found");
       return false;
     }
 
     // If current preset is enabled, we're done
-    if (presets[currentPresetIndex].enabled) {
-      Serial.printf("Previous enabled preset: %d (%s)\n", currentPresetIndex, presets[currentPresetIndex].name.c_str());
+    if (summaries[currentPresetIndex].enabled) {
+      noteIndexChange();
+      Serial.printf("Previous enabled preset: %d (%s)\n", currentPresetIndex, summaries[currentPresetIndex].label.c_str());
       return true;
     }
   } while (currentPresetIndex != startIndex);
@@ -291,7 +595,7 @@ bool PresetManager::previousEnabled() {
 // ====== VALIDATION ======
 
 bool PresetManager::isValidIndex(int index) const {
-  return index >= 0 && index < (int)presets.size();
+  return index >= 0 && index < (int)summaries.size();
 }
 
 bool PresetManager::validatePreset(const Preset& preset) const {
@@ -318,9 +622,12 @@ bool PresetManager::validatePreset(const Preset& preset) const {
 // ====== UTILITY ======
 
 void PresetManager::clear() {
-  presets.clear();
+  summaries.clear();
+  cache.clear();
+  dirtyFields.clear();
   currentPresetIndex = 0;
-  isDirty = true;
+  noteIndexChange();
+  markTableDirty();
   Serial.println("All presets cleared");
 }
 
@@ -2,20 +2,59 @@
 #define PRESETMANAGER_H
 
 #include <Arduino.h>
+#include <list>
 #include <vector>
 #include "../../include/Types.h"
 #include "../Storage/SettingsManager.h"
 
 class PresetManager {
 private:
-  std::vector<Preset> presets;
+  // Resident index; full presets are hydrated from storage on demand
+  struct CachedPreset {
+    int index;
+    Preset preset;
+  };
+
+  std::vector<PresetSummary> summaries;
+  std::list<CachedPreset> cache;  // Most recently used first
+  uint32_t cacheHits;
+  uint32_t cacheMisses;
   int currentPresetIndex;
   SettingsManager* settings;
-  bool isDirty;  // Track if presets need saving
+
+  // Dirty tracking - parallel to presets, one PresetField mask each
+  std::vector<uint8_t> dirtyFields;
+  bool tableDirty;               // Presets added, removed or reordered
+  int persistedIndex;            // Current index as last written (-1 = unknown)
+  unsigned long indexChangedAt;  // Index is saved once stable for PRESET_INDEX_SETTLE_MS
+  uint32_t indexWrites;
+  unsigned long firstDirtyAt;    // Start of the pending edit burst (0 = clean)
+  unsigned long lastDirtyAt;
+  uint32_t flushCount;
+  uint32_t skippedWrites;        // Updates that changed nothing
+  int legacyKeysPending;         // Legacy preset_N_* keys to drop once the migrated table is saved
+
+  Preset* hydrate(int index);
+  size_t getTableBytes();  // Encoded table size as it would be saved now
+  bool isPinned(int index) const;  // Unsaved changes - must stay in the cache
+  void trimCache();
+  void adopt(const std::vector<Preset>& all);
+  static PresetSummary summarize(const Preset& preset, int16_t stored);
+
+  void markDirty(int index, uint8_t fields);
+  void markTableDirty();
+  void markClean();
+  void noteIndexChange();
+  bool persistIndex();
+  static uint8_t diffFields(const Preset& a, const Preset& b);
 
   // Initialize default presets if none exist
   void initializeDefaults();
 
+  // Convert preset_N_* keys into the binary table. False if it could not be
+  // saved yet - the table then stays dirty and flushIfDue() retries.
+  bool migrateLegacy();
+
 public:
   PresetManager(SettingsManager* settingsManager);
 
@@ -28,14 +67,19 @@ public:
   bool addPreset(const Preset& preset);
   bool updatePreset(int index, const Preset& preset);
   bool deletePreset(int index);
+
+  // Full preset, loaded into the LRU cache if needed. The pointer stays
+  // valid until another preset is requested or the table changes.
   Preset* getPreset(int index);
-  const Preset* getPreset(int index) const;
+
+  // Index entry only (label, type, enabled) - never touches storage
+  const PresetSummary* getSummary(int index) const;
 
   // Navigation
-  int getCount() const { return presets.size(); }
+  int getCount() const { return summaries.size(); }
   int getCurrentIndex() const { return currentPresetIndex; }
   Preset* getCurrent();
-  const Preset* getCurrent() const;
+  const PresetSummary* getCurrentSummary() const { return getSummary(currentPresetIndex); }
   bool setCurrentIndex(int index);
   bool next();
   bool previous();
@@ -46,10 +90,20 @@ public:
   bool isValidIndex(int index) const;
   bool validatePreset(const Preset& preset) const;
 
+  // Persistence - edits are coalesced and written by flushIfDue()
+  bool hasDirtyFlag() const;
+  uint8_t getDirtyFields(int index) const;
+  bool flushIfDue();   // Call periodically (storage task)
+  bool flush();        // Write pending changes now (before sleep/restart)
+  uint32_t getFlushCount() const { return flushCount; }
+  uint32_t getSkippedWrites() const { return skippedWrites; }
+  uint32_t getIndexWrites() const { return indexWrites; }
+  uint32_t getCacheHits() const { return cacheHits; }
+  uint32_t getCacheMisses() const { return cacheMisses; }
+  int getCachedCount() const { return cache.size(); }
+
   // Utility
   void clear();
-  bool hasDirtyFlag() const { return isDirty; }
-  void clearDirtyFlag() { isDirty = false; }
 
   // Get display name for a preset (auto-generate from stations if empty)
   static String getDisplayName(const Preset& preset);
@@ -0,0 +1,78 @@
+#include "StationIndex.h"
+#include "StationIndexData.h"
+#include <ctype.h>
+
+int StationIndex::getCount() {
+  return STATION_INDEX_COUNT;
+}
+
+int StationIndex::compareFolded(const char* a, const char* b, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    int ca = tolower((unsigned char)a[i]);
+    int cb = tolower((unsigned char)b[i]);
+    if (ca != cb || ca == 0) {
+      return ca - cb;
+    }
+  }
+  return 0;
+}
+
+size_t StationIndex::bucketOffset(int bucket) {
+  return pgm_read_word(&STATION_INDEX_BUCKETS[bucket]);
+}
+
+size_t StationIndex::decodeEntry(size_t offset, char* name) {
+  // name holds the previous entry; keep its shared prefix, append the suffix
+  uint8_t shared = pgm_read_byte(&STATION_INDEX_BLOB[offset]);
+  uint8_t length = pgm_read_byte(&STATION_INDEX_BLOB[offset + 1]);
+  memcpy_P(name + shared, &STATION_INDEX_BLOB[offset + 2], length);
+  name[shared + length] = '\0';
+  return offset + 2 + length;
+}
+
+int StationIndex::complete(const String& prefix, String results[], int maxResults, int* total) {
+  size_t prefixLength = prefix.length();
+  const char* key = prefix.c_str();
+  char name[STATION_INDEX_NAME_MAX + 1];
+
+  // Last bucket whose head sorts before the prefix; matches start in it or the next
+  int low = 0;
+  int high = STATION_INDEX_BUCKET_COUNT - 1;
+  int start = 0;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    decodeEntry(bucketOffset(mid), name);
+    if (compareFolded(name, key, prefixLength + 1) < 0) {
+      start = mid;
+      low = mid + 1;
+    } else {
+      high = mid - 1;
+    }
+  }
+
+  int found = 0;
+  int matches = 0;
+  size_t offset = bucketOffset(start);
+  for (int i = start * STATION_INDEX_BUCKET_SIZE; i < STATION_INDEX_COUNT; i++) {
+    offset = decodeEntry(offset, name);
+    int order = compareFolded(name, key, prefixLength);
+    if (order < 0) {
+      continue;
+    }
+    if (order > 0) {
+      break;  // Sorted - nothing later can match
+    }
+    if (found < maxResults) {
+      results[found++] = name;
+    }
+    matches++;
+    if (!total && found == maxResults) {
+      break;
+    }
+  }
+
+  if (total) {
+    *total = matches;
+  }
+  return found;
+}
@@ -0,0 +1,27 @@
+#ifndef STATIONINDEX_H
+#define STATIONINDEX_H
+
+#include <Arduino.h>
+
+// ====== STATION INDEX ======
+// Sorted, front-coded station names in flash (StationIndexData.h, built by
+// tools/gen_station_index.py from tools/stations.txt). Prefix lookups
+// binary-search the bucket heads, then decode forward from one bucket.
+// Matching ignores ASCII case.
+
+class StationIndex {
+private:
+  static int compareFolded(const char* a, const char* b, size_t length);
+  static size_t decodeEntry(size_t offset, char* name);
+  static size_t bucketOffset(int bucket);
+
+public:
+  // Fill results with up to maxResults names starting with prefix, in
+  // sorted order. Returns the number of names filled; total (optional)
+  // receives how many names match altogether.
+  static int complete(const String& prefix, String results[], int maxResults, int* total = nullptr);
+
+  static int getCount();
+};
+
+#endif // STATIONINDEX_H
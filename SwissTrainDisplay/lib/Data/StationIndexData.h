@@ -0,0 +1,125 @@
+// Generated by tools/gen_station_index.py from tools/stations.txt - do not edit
+// 180 stations, 1671 bytes front-coded (1828 bytes as plain strings)
+
+#ifndef STATIONINDEXDATA_H
+#define STATIONINDEXDATA_H
+
+#define STATION_INDEX_COUNT 180
+#define STATION_INDEX_BUCKET_SIZE 16
+#define STATION_INDEX_BUCKET_COUNT 12
+#define STATION_INDEX_NAME_MAX 32
+
+static const uint8_t STATION_INDEX_BLOB[] PROGMEM = {
+  0x00, 0x05, 0x41, 0x61, 0x72, 0x61, 0x75, 0x03, 0x0e, 0x62, 0x75, 0x72, 0x67, 0x2d, 0x4f, 0x66,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x01, 0x07, 0x64, 0x6c, 0x69, 0x73, 0x77, 0x69, 0x6c,
+  0x01, 0x04, 0x69, 0x67, 0x6c, 0x65, 0x02, 0x04, 0x72, 0x6f, 0x6c, 0x6f, 0x01, 0x06, 0x6c, 0x6c,
+  0x61, 0x6d, 0x61, 0x6e, 0x02, 0x0b, 0x74, 0x73, 0x74, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x53,
+  0x47, 0x01, 0x08, 0x6e, 0x64, 0x65, 0x72, 0x6d, 0x61, 0x74, 0x74, 0x01, 0x04, 0x72, 0x62, 0x6f,
+  0x6e, 0x02, 0x09, 0x74, 0x68, 0x2d, 0x47, 0x6f, 0x6c, 0x64, 0x61, 0x75, 0x00, 0x04, 0x42, 0x61,
+  0x61, 0x72, 0x02, 0x03, 0x64, 0x65, 0x6e, 0x02, 0x0a, 0x73, 0x65, 0x6c, 0x20, 0x42, 0x61, 0x64,
+  0x20, 0x42, 0x66, 0x06, 0x03, 0x53, 0x42, 0x42, 0x07, 0x09, 0x74, 0x2e, 0x20, 0x4a, 0x6f, 0x68,
+  0x61, 0x6e, 0x6e, 0x01, 0x09, 0x65, 0x6c, 0x6c, 0x69, 0x6e, 0x7a, 0x6f, 0x6e, 0x61, 0x00, 0x04,
+  0x42, 0x65, 0x72, 0x6e, 0x04, 0x0d, 0x20, 0x42, 0x75, 0x6d, 0x70, 0x6c, 0x69, 0x7a, 0x20, 0x4e,
+  0x6f, 0x72, 0x64, 0x05, 0x08, 0x57, 0x61, 0x6e, 0x6b, 0x64, 0x6f, 0x72, 0x66, 0x02, 0x01, 0x78,
+  0x01, 0x05, 0x69, 0x61, 0x73, 0x63, 0x61, 0x02, 0x09, 0x65, 0x6c, 0x2f, 0x42, 0x69, 0x65, 0x6e,
+  0x6e, 0x65, 0x01, 0x05, 0x72, 0x69, 0x65, 0x6e, 0x7a, 0x03, 0x01, 0x67, 0x02, 0x06, 0x75, 0x67,
+  0x67, 0x20, 0x41, 0x47, 0x03, 0x04, 0x6e, 0x6e, 0x65, 0x6e, 0x01, 0x07, 0x75, 0x63, 0x68, 0x73,
+  0x20, 0x53, 0x47, 0x02, 0x04, 0x6c, 0x61, 0x63, 0x68, 0x03, 0x02, 0x6c, 0x65, 0x02, 0x06, 0x72,
+  0x67, 0x64, 0x6f, 0x72, 0x66, 0x02, 0x06, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x79, 0x00, 0x04, 0x43,
+  0x68, 0x61, 0x6d, 0x00, 0x0f, 0x43, 0x68, 0x61, 0x74, 0x65, 0x6c, 0x2d, 0x53, 0x74, 0x2d, 0x44,
+  0x65, 0x6e, 0x69, 0x73, 0x02, 0x05, 0x69, 0x61, 0x73, 0x73, 0x6f, 0x02, 0x02, 0x75, 0x72, 0x01,
+  0x05, 0x6f, 0x70, 0x70, 0x65, 0x74, 0x02, 0x10, 0x73, 0x73, 0x6f, 0x6e, 0x61, 0x79, 0x2d, 0x50,
+  0x65, 0x6e, 0x74, 0x68, 0x61, 0x6c, 0x61, 0x7a, 0x00, 0x0b, 0x44, 0x61, 0x76, 0x6f, 0x73, 0x20,
+  0x50, 0x6c, 0x61, 0x74, 0x7a, 0x01, 0x07, 0x65, 0x6c, 0x65, 0x6d, 0x6f, 0x6e, 0x74, 0x01, 0x07,
+  0x69, 0x65, 0x74, 0x69, 0x6b, 0x6f, 0x6e, 0x02, 0x0d, 0x73, 0x65, 0x6e, 0x74, 0x69, 0x73, 0x2f,
+  0x4d, 0x75, 0x73, 0x74, 0x65, 0x72, 0x01, 0x07, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x00,
+  0x0a, 0x45, 0x66, 0x66, 0x72, 0x65, 0x74, 0x69, 0x6b, 0x6f, 0x6e, 0x01, 0x09, 0x69, 0x6e, 0x73,
+  0x69, 0x65, 0x64, 0x65, 0x6c, 0x6e, 0x01, 0x0a, 0x6d, 0x6d, 0x65, 0x6e, 0x62, 0x72, 0x75, 0x63,
+  0x6b, 0x65, 0x01, 0x08, 0x6e, 0x67, 0x65, 0x6c, 0x62, 0x65, 0x72, 0x67, 0x01, 0x07, 0x72, 0x73,
+  0x74, 0x66, 0x65, 0x6c, 0x64, 0x01, 0x0f, 0x73, 0x74, 0x61, 0x76, 0x61, 0x79, 0x65, 0x72, 0x2d,
+  0x6c, 0x65, 0x2d, 0x4c, 0x61, 0x63, 0x00, 0x05, 0x46, 0x61, 0x69, 0x64, 0x6f, 0x01, 0x06, 0x6c,
+  0x75, 0x65, 0x6c, 0x65, 0x6e, 0x01, 0x09, 0x72, 0x61, 0x75, 0x65, 0x6e, 0x66, 0x65, 0x6c, 0x64,
+  0x02, 0x0f, 0x69, 0x62, 0x6f, 0x75, 0x72, 0x67, 0x2f, 0x46, 0x72, 0x65, 0x69, 0x62, 0x75, 0x72,
+  0x67, 0x02, 0x06, 0x75, 0x74, 0x69, 0x67, 0x65, 0x6e, 0x00, 0x06, 0x47, 0x65, 0x6e, 0x65, 0x76,
+  0x65, 0x06, 0x09, 0x20, 0x41, 0x65, 0x72, 0x6f, 0x70, 0x6f, 0x72, 0x74, 0x06, 0x0b, 0x2d, 0x45,
+  0x61, 0x75, 0x78, 0x2d, 0x56, 0x69, 0x76, 0x65, 0x73, 0x01, 0x04, 0x6c, 0x61, 0x6e, 0x64, 0x03,
+  0x03, 0x72, 0x75, 0x73, 0x01, 0x08, 0x6f, 0x73, 0x63, 0x68, 0x65, 0x6e, 0x65, 0x6e, 0x03, 0x06,
+  0x73, 0x61, 0x75, 0x20, 0x53, 0x47, 0x01, 0x07, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x6f, 0x6e, 0x02,
+  0x0b, 0x65, 0x6e, 0x63, 0x68, 0x65, 0x6e, 0x20, 0x4e, 0x6f, 0x72, 0x64, 0x09, 0x03, 0x53, 0x75,
+  0x64, 0x02, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x6c, 0x77, 0x61, 0x6c, 0x64, 0x00, 0x08, 0x47, 0x72,
+  0x75, 0x79, 0x65, 0x72, 0x65, 0x73, 0x01, 0x05, 0x73, 0x74, 0x61, 0x61, 0x64, 0x00, 0x07, 0x48,
+  0x65, 0x72, 0x69, 0x73, 0x61, 0x75, 0x03, 0x0c, 0x7a, 0x6f, 0x67, 0x65, 0x6e, 0x62, 0x75, 0x63,
+  0x68, 0x73, 0x65, 0x65, 0x01, 0x05, 0x6f, 0x72, 0x67, 0x65, 0x6e, 0x01, 0x06, 0x75, 0x74, 0x74,
+  0x77, 0x69, 0x6c, 0x00, 0x05, 0x49, 0x6c, 0x61, 0x6e, 0x7a, 0x01, 0x02, 0x6e, 0x73, 0x02, 0x0c,
+  0x74, 0x65, 0x72, 0x6c, 0x61, 0x6b, 0x65, 0x6e, 0x20, 0x4f, 0x73, 0x74, 0x0b, 0x04, 0x57, 0x65,
+  0x73, 0x74, 0x00, 0x07, 0x4b, 0x65, 0x72, 0x7a, 0x65, 0x72, 0x73, 0x01, 0x0f, 0x6c, 0x65, 0x69,
+  0x6e, 0x65, 0x20, 0x53, 0x63, 0x68, 0x65, 0x69, 0x64, 0x65, 0x67, 0x67, 0x02, 0x0c, 0x6f, 0x73,
+  0x74, 0x65, 0x72, 0x73, 0x20, 0x50, 0x6c, 0x61, 0x74, 0x7a, 0x03, 0x03, 0x74, 0x65, 0x6e, 0x01,
+  0x0a, 0x6f, 0x6e, 0x6f, 0x6c, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x01, 0x0a, 0x72, 0x65, 0x75,
+  0x7a, 0x6c, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x00, 0x0b, 0x4b, 0x75, 0x73, 0x6e, 0x61, 0x63, 0x68,
+  0x74, 0x20, 0x5a, 0x48, 0x00, 0x11, 0x4c, 0x61, 0x20, 0x43, 0x68, 0x61, 0x75, 0x78, 0x2d, 0x64,
+  0x65, 0x2d, 0x46, 0x6f, 0x6e, 0x64, 0x73, 0x02, 0x07, 0x6e, 0x64, 0x71, 0x75, 0x61, 0x72, 0x74,
+  0x03, 0x07, 0x67, 0x65, 0x6e, 0x74, 0x68, 0x61, 0x6c, 0x04, 0x08, 0x6e, 0x61, 0x75, 0x20, 0x69,
+  0x2e, 0x45, 0x2e, 0x02, 0x04, 0x75, 0x66, 0x65, 0x6e, 0x03, 0x05, 0x73, 0x61, 0x6e, 0x6e, 0x65,
+  0x03, 0x0a, 0x74, 0x65, 0x72, 0x62, 0x72, 0x75, 0x6e, 0x6e, 0x65, 0x6e, 0x01, 0x07, 0x65, 0x20,
+  0x4c, 0x6f, 0x63, 0x6c, 0x65, 0x02, 0x06, 0x6e, 0x7a, 0x62, 0x75, 0x72, 0x67, 0x02, 0x02, 0x75,
+  0x6b, 0x01, 0x06, 0x69, 0x65, 0x73, 0x74, 0x61, 0x6c, 0x01, 0x06, 0x6f, 0x63, 0x61, 0x72, 0x6e,
+  0x6f, 0x01, 0x05, 0x75, 0x63, 0x65, 0x6e, 0x73, 0x02, 0x04, 0x67, 0x61, 0x6e, 0x6f, 0x06, 0x09,
+  0x2d, 0x50, 0x61, 0x72, 0x61, 0x64, 0x69, 0x73, 0x6f, 0x00, 0x06, 0x4c, 0x75, 0x7a, 0x65, 0x72,
+  0x6e, 0x01, 0x03, 0x79, 0x73, 0x73, 0x00, 0x08, 0x4d, 0x61, 0x72, 0x74, 0x69, 0x67, 0x6e, 0x79,
+  0x01, 0x05, 0x65, 0x69, 0x6c, 0x65, 0x6e, 0x03, 0x06, 0x72, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x02,
+  0x07, 0x6e, 0x64, 0x72, 0x69, 0x73, 0x69, 0x6f, 0x01, 0x06, 0x6f, 0x6e, 0x74, 0x68, 0x65, 0x79,
+  0x04, 0x04, 0x72, 0x65, 0x75, 0x78, 0x02, 0x04, 0x72, 0x67, 0x65, 0x73, 0x02, 0x04, 0x75, 0x64,
+  0x6f, 0x6e, 0x03, 0x04, 0x74, 0x69, 0x65, 0x72, 0x01, 0x08, 0x75, 0x6e, 0x73, 0x69, 0x6e, 0x67,
+  0x65, 0x6e, 0x02, 0x0a, 0x72, 0x74, 0x65, 0x6e, 0x2f, 0x4d, 0x6f, 0x72, 0x61, 0x74, 0x00, 0x09,
+  0x4e, 0x65, 0x75, 0x63, 0x68, 0x61, 0x74, 0x65, 0x6c, 0x01, 0x03, 0x79, 0x6f, 0x6e, 0x00, 0x09,
+  0x4f, 0x65, 0x6e, 0x73, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x00, 0x05, 0x4f, 0x6c, 0x74, 0x65, 0x6e,
+  0x00, 0x09, 0x50, 0x61, 0x6c, 0x65, 0x7a, 0x69, 0x65, 0x75, 0x78, 0x02, 0x05, 0x79, 0x65, 0x72,
+  0x6e, 0x65, 0x01, 0x0b, 0x66, 0x61, 0x66, 0x66, 0x69, 0x6b, 0x6f, 0x6e, 0x20, 0x53, 0x5a, 0x01,
+  0x09, 0x6f, 0x6e, 0x74, 0x72, 0x65, 0x73, 0x69, 0x6e, 0x61, 0x02, 0x08, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x72, 0x75, 0x79, 0x02, 0x07, 0x73, 0x63, 0x68, 0x69, 0x61, 0x76, 0x6f, 0x01, 0x0c, 0x72,
+  0x69, 0x6c, 0x6c, 0x79, 0x2d, 0x4d, 0x61, 0x6c, 0x6c, 0x65, 0x79, 0x01, 0x0f, 0x75, 0x69, 0x64,
+  0x6f, 0x75, 0x78, 0x2d, 0x43, 0x68, 0x65, 0x78, 0x62, 0x72, 0x65, 0x73, 0x00, 0x0a, 0x52, 0x61,
+  0x70, 0x70, 0x65, 0x72, 0x73, 0x77, 0x69, 0x6c, 0x01, 0x08, 0x65, 0x6e, 0x65, 0x6e, 0x73, 0x20,
+  0x56, 0x44, 0x01, 0x0a, 0x68, 0x65, 0x69, 0x6e, 0x66, 0x65, 0x6c, 0x64, 0x65, 0x6e, 0x01, 0x0a,
+  0x69, 0x63, 0x68, 0x74, 0x65, 0x72, 0x73, 0x77, 0x69, 0x6c, 0x01, 0x04, 0x6f, 0x6c, 0x6c, 0x65,
+  0x02, 0x08, 0x6d, 0x61, 0x6e, 0x73, 0x68, 0x6f, 0x72, 0x6e, 0x03, 0x06, 0x6f, 0x6e, 0x74, 0x20,
+  0x46, 0x52, 0x00, 0x09, 0x52, 0x6f, 0x72, 0x73, 0x63, 0x68, 0x61, 0x63, 0x68, 0x02, 0x06, 0x74,
+  0x6b, 0x72, 0x65, 0x75, 0x7a, 0x00, 0x0c, 0x53, 0x61, 0x69, 0x67, 0x6e, 0x65, 0x6c, 0x65, 0x67,
+  0x69, 0x65, 0x72, 0x02, 0x05, 0x6d, 0x65, 0x64, 0x61, 0x6e, 0x02, 0x05, 0x72, 0x67, 0x61, 0x6e,
+  0x73, 0x03, 0x03, 0x6e, 0x65, 0x6e, 0x01, 0x0b, 0x63, 0x68, 0x61, 0x66, 0x66, 0x68, 0x61, 0x75,
+  0x73, 0x65, 0x6e, 0x03, 0x03, 0x77, 0x79, 0x7a, 0x02, 0x0a, 0x75, 0x6f, 0x6c, 0x2d, 0x54, 0x61,
+  0x72, 0x61, 0x73, 0x70, 0x01, 0x0c, 0x69, 0x65, 0x72, 0x72, 0x65, 0x2f, 0x53, 0x69, 0x64, 0x65,
+  0x72, 0x73, 0x02, 0x02, 0x6f, 0x6e, 0x01, 0x08, 0x6f, 0x6c, 0x6f, 0x74, 0x68, 0x75, 0x72, 0x6e,
+  0x01, 0x04, 0x70, 0x69, 0x65, 0x7a, 0x01, 0x07, 0x74, 0x2d, 0x49, 0x6d, 0x69, 0x65, 0x72, 0x03,
+  0x07, 0x4d, 0x61, 0x75, 0x72, 0x69, 0x63, 0x65, 0x02, 0x08, 0x2e, 0x20, 0x47, 0x61, 0x6c, 0x6c,
+  0x65, 0x6e, 0x00, 0x0e, 0x53, 0x74, 0x2e, 0x20, 0x4d, 0x61, 0x72, 0x67, 0x72, 0x65, 0x74, 0x68,
+  0x65, 0x6e, 0x05, 0x05, 0x6f, 0x72, 0x69, 0x74, 0x7a, 0x02, 0x0c, 0x65, 0x69, 0x6e, 0x20, 0x61,
+  0x6d, 0x20, 0x52, 0x68, 0x65, 0x69, 0x6e, 0x01, 0x05, 0x75, 0x72, 0x73, 0x65, 0x65, 0x00, 0x08,
+  0x54, 0x61, 0x76, 0x61, 0x6e, 0x6e, 0x65, 0x73, 0x01, 0x06, 0x68, 0x61, 0x6c, 0x77, 0x69, 0x6c,
+  0x02, 0x02, 0x75, 0x6e, 0x03, 0x03, 0x73, 0x69, 0x73, 0x00, 0x05, 0x55, 0x73, 0x74, 0x65, 0x72,
+  0x01, 0x04, 0x7a, 0x77, 0x69, 0x6c, 0x00, 0x08, 0x56, 0x61, 0x6c, 0x6c, 0x6f, 0x72, 0x62, 0x65,
+  0x01, 0x04, 0x65, 0x76, 0x65, 0x79, 0x01, 0x03, 0x69, 0x73, 0x70, 0x00, 0x09, 0x57, 0x61, 0x64,
+  0x65, 0x6e, 0x73, 0x77, 0x69, 0x6c, 0x02, 0x09, 0x6c, 0x6c, 0x69, 0x73, 0x65, 0x6c, 0x6c, 0x65,
+  0x6e, 0x01, 0x09, 0x65, 0x69, 0x6e, 0x66, 0x65, 0x6c, 0x64, 0x65, 0x6e, 0x00, 0x06, 0x57, 0x65,
+  0x6e, 0x67, 0x65, 0x6e, 0x02, 0x07, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x03, 0x05, 0x7a,
+  0x69, 0x6b, 0x6f, 0x6e, 0x01, 0x05, 0x69, 0x6c, 0x20, 0x53, 0x47, 0x02, 0x08, 0x6e, 0x74, 0x65,
+  0x72, 0x74, 0x68, 0x75, 0x72, 0x01, 0x08, 0x6f, 0x68, 0x6c, 0x65, 0x6e, 0x20, 0x41, 0x47, 0x00,
+  0x11, 0x59, 0x76, 0x65, 0x72, 0x64, 0x6f, 0x6e, 0x2d, 0x6c, 0x65, 0x73, 0x2d, 0x42, 0x61, 0x69,
+  0x6e, 0x73, 0x00, 0x07, 0x5a, 0x65, 0x72, 0x6d, 0x61, 0x74, 0x74, 0x01, 0x0b, 0x69, 0x65, 0x67,
+  0x65, 0x6c, 0x62, 0x72, 0x75, 0x63, 0x6b, 0x65, 0x01, 0x07, 0x6f, 0x66, 0x69, 0x6e, 0x67, 0x65,
+  0x6e, 0x01, 0x02, 0x75, 0x67, 0x02, 0x0f, 0x72, 0x69, 0x63, 0x68, 0x20, 0x41, 0x6c, 0x74, 0x73,
+  0x74, 0x65, 0x74, 0x74, 0x65, 0x6e, 0x07, 0x04, 0x45, 0x6e, 0x67, 0x65, 0x07, 0x09, 0x46, 0x6c,
+  0x75, 0x67, 0x68, 0x61, 0x66, 0x65, 0x6e, 0x07, 0x0a, 0x48, 0x61, 0x72, 0x64, 0x62, 0x72, 0x75,
+  0x63, 0x6b, 0x65, 0x08, 0x01, 0x42, 0x00, 0x0f, 0x5a, 0x75, 0x72, 0x69, 0x63, 0x68, 0x20, 0x4f,
+  0x65, 0x72, 0x6c, 0x69, 0x6b, 0x6f, 0x6e, 0x07, 0x0b, 0x53, 0x74, 0x61, 0x64, 0x65, 0x6c, 0x68,
+  0x6f, 0x66, 0x65, 0x6e, 0x09, 0x07, 0x65, 0x74, 0x74, 0x62, 0x61, 0x63, 0x68, 0x07, 0x08, 0x57,
+  0x69, 0x65, 0x64, 0x69, 0x6b, 0x6f, 0x6e,
+};
+
+static const uint16_t STATION_INDEX_BUCKETS[] PROGMEM = {
+  0, 142, 259, 438, 588, 743, 889, 1017,
+  1186, 1330, 1468, 1622,
+};
+
+#endif // STATIONINDEXDATA_H
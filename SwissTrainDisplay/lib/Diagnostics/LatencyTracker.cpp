@@ -0,0 +1,90 @@
+#include "LatencyTracker.h"
+
+// Upper bucket bounds in ms; the last bucket collects everything slower
+static const uint16_t BUCKET_LIMITS_MS[LATENCY_BUCKET_COUNT - 1] = {
+  10, 20, 35, 50, 75, 100, 200
+};
+
+void LatencyHistogram::reset() {
+  memset(buckets, 0, sizeof(buckets));
+  count = 0;
+  totalUs = 0;
+  maxUs = 0;
+}
+
+int LatencyTracker::bucketFor(unsigned long latencyUs) {
+  for (int i = 0; i < LATENCY_BUCKET_COUNT - 1; i++) {
+    if (latencyUs < (unsigned long)BUCKET_LIMITS_MS[i] * 1000) {
+      return i;
+    }
+  }
+  return LATENCY_BUCKET_COUNT - 1;
+}
+
+void LatencyTracker::record(AppState state, unsigned long latencyUs) {
+  if (state < 0 || state >= LATENCY_STATE_COUNT) {
+    return;
+  }
+
+  LatencyHistogram& h = histograms[state];
+  h.buckets[bucketFor(latencyUs)]++;
+  h.count++;
+  h.totalUs += latencyUs;
+  if (latencyUs > h.maxUs) {
+    h.maxUs = latencyUs;
+  }
+}
+
+void LatencyTracker::reset() {
+  for (int i = 0; i < LATENCY_STATE_COUNT; i++) {
+    histograms[i].reset();
+  }
+}
+
+void LatencyTracker::print() const {
+  Serial.println("Input-to-photon latency (ms):");
+
+  // Header row with bucket bounds
+  Serial.printf("  %-14s %6s %6s %6s ", "screen", "n", "avg", "max");
+  for (int i = 0; i < LATENCY_BUCKET_COUNT - 1; i++) {
+    Serial.printf(" <%-4u", BUCKET_LIMITS_MS[i]);
+  }
+  Serial.printf(" >=%-3u\n", BUCKET_LIMITS_MS[LATENCY_BUCKET_COUNT - 2]);
+
+  bool any = false;
+  for (int s = 0; s < LATENCY_STATE_COUNT; s++) {
+    const LatencyHistogram& h = histograms[s];
+    if (h.count == 0) {
+      continue;
+    }
+    any = true;
+
+    Serial.printf("  %-14s %6lu %6.1f %6.1f ", stateName((AppState)s),
+                  (unsigned long)h.count,
+                  h.totalUs / 1000.0f / h.count,
+                  h.maxUs / 1000.0f);
+    for (int i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+      Serial.printf(" %-5lu", (unsigned long)h.buckets[i]);
+    }
+    Serial.println();
+  }
+
+  if (!any) {
+    Serial.println("  (no samples yet)");
+  }
+}
+
+const char* LatencyTracker::stateName(AppState state) {
+  switch (state) {
+    case STATE_MAIN_DISPLAY:  return "main";
+    case STATE_MENU:          return "menu";
+    case STATE_SETTINGS:      return "settings";
+    case STATE_WIFI_SCAN:     return "wifi_scan";
+    case STATE_WIFI_PASSWORD: return "wifi_password";
+    case STATE_PRESET_SELECT: return "preset_select";
+    case STATE_PRESET_EDIT:   return "preset_edit";
+    case STATE_ERROR:         return "error";
+    case STATE_STORAGE_INFO:  return "storage";
+  }
+  return "?";
+}
@@ -0,0 +1,45 @@
+#ifndef LATENCYTRACKER_H
+#define LATENCYTRACKER_H
+
+#include <Arduino.h>
+#include "../../include/Config.h"
+#include "../../include/AppState.h"
+
+// ====== LATENCY HISTOGRAM ======
+// Input-to-photon latency: from the ISR timestamp of an encoder detent or
+// button gesture to the end of the display flush that shows its effect.
+
+#define LATENCY_STATE_COUNT (STATE_STORAGE_INFO + 1)
+
+struct LatencyHistogram {
+  uint32_t buckets[LATENCY_BUCKET_COUNT];
+  uint32_t count;
+  uint64_t totalUs;
+  uint32_t maxUs;
+
+  LatencyHistogram() { reset(); }
+  void reset();
+};
+
+class LatencyTracker {
+private:
+  LatencyHistogram histograms[LATENCY_STATE_COUNT];
+
+  static int bucketFor(unsigned long latencyUs);
+
+public:
+  LatencyTracker() {}
+
+  // Record one sample against the screen that received the input
+  void record(AppState state, unsigned long latencyUs);
+
+  const LatencyHistogram& getHistogram(AppState state) const { return histograms[state]; }
+  void reset();
+
+  // Print per-screen histograms to Serial
+  void print() const;
+
+  static const char* stateName(AppState state);
+};
+
+#endif // LATENCYTRACKER_H
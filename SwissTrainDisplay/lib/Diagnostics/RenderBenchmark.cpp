@@ -0,0 +1,109 @@
+#include "RenderBenchmark.h"
+
+// Strings that are drawn repeatedly in normal use
+static const char* const BENCH_LABELS[] = {
+  "Loading...",
+  "No connections",
+  "Lausanne -> Zurich",
+  "Connecting WiFi...",
+  "Press any button"
+};
+static const int BENCH_LABEL_COUNT = sizeof(BENCH_LABELS) / sizeof(BENCH_LABELS[0]);
+
+void RenderBenchmark::report(const char* label, unsigned long elapsedUs, int iterations) {
+  Serial.printf("  %-28s %8lu us total, %6.2f us/op\n",
+                label, elapsedUs, (float)elapsedUs / iterations);
+}
+
+void RenderBenchmark::run(DisplayManager& disp, int iterations) {
+  Serial.println("\n===== Render benchmark =====");
+  benchTextMetrics(disp, iterations);
+  benchLargeDigits(disp, iterations);
+  benchFills(disp, iterations);
+  Serial.println("============================\n");
+}
+
+void RenderBenchmark::benchTextMetrics(DisplayManager& disp, int iterations) {
+  Adafruit_SSD1306& d = disp.getDisplay();
+  int ops = iterations * BENCH_LABEL_COUNT;
+  volatile uint32_t sink = 0;  // Keep results alive
+
+  Serial.println("Text metrics (centered text width):");
+
+  // Baseline: walk every glyph through getTextBounds
+  unsigned long start = micros();
+  for (int i = 0; i < iterations; i++) {
+    for (int j = 0; j < BENCH_LABEL_COUNT; j++) {
+      int16_t x1, y1;
+      uint16_t w, h;
+      d.setTextSize(1);
+      d.getTextBounds(BENCH_LABELS[j], 0, 0, &x1, &y1, &w, &h);
+      sink += w;
+    }
+  }
+  report("getTextBounds", micros() - start, ops);
+
+  // Memoized width lookup
+  disp.clearTextMetricsCache();
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    for (int j = 0; j < BENCH_LABEL_COUNT; j++) {
+      sink += disp.getTextWidth(BENCH_LABELS[j], 1);
+    }
+  }
+  report("getTextWidth (cached)", micros() - start, ops);
+  Serial.printf("  cache hits: %lu, misses: %lu\n",
+                (unsigned long)disp.getTextMetricsHits(),
+                (unsigned long)disp.getTextMetricsMisses());
+  (void)sink;
+}
+
+void RenderBenchmark::benchLargeDigits(DisplayManager& disp, int iterations) {
+  Adafruit_SSD1306& d = disp.getDisplay();
+  const char* timeStr = "12:34";
+
+  Serial.println("Large digits (\"12:34\"):");
+
+  for (int size = 2; size <= 3; size++) {
+    // Baseline: Adafruit_GFX scales the 5x7 font pixel by pixel
+    unsigned long start = micros();
+    for (int i = 0; i < iterations; i++) {
+      d.setTextSize(size);
+      d.setTextColor(SSD1306_WHITE);
+      d.setCursor(2, 20);
+      d.print(timeStr);
+    }
+    report(size == 2 ? "GFX print size 2" : "GFX print size 3", micros() - start, iterations);
+
+    // Pre-rendered atlas blitted into the framebuffer
+    start = micros();
+    for (int i = 0; i < iterations; i++) {
+      disp.drawText(timeStr, 2, 20, size);
+    }
+    report(size == 2 ? "Glyph atlas size 2" : "Glyph atlas size 3", micros() - start, iterations);
+  }
+
+  disp.clear();
+}
+
+void RenderBenchmark::benchFills(DisplayManager& disp, int iterations) {
+  Adafruit_SSD1306& d = disp.getDisplay();
+
+  Serial.println("Fills (yellow bar + menu highlight):");
+
+  unsigned long start = micros();
+  for (int i = 0; i < iterations; i++) {
+    d.fillRect(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT, SSD1306_WHITE);
+    d.fillRect(0, BLUE_ZONE_Y + 12, SCREEN_WIDTH, MENU_ITEM_HEIGHT, SSD1306_WHITE);
+  }
+  report("Adafruit_GFX fillRect", micros() - start, iterations);
+
+  start = micros();
+  for (int i = 0; i < iterations; i++) {
+    disp.fillRectFast(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT);
+    disp.fillRectFast(0, BLUE_ZONE_Y + 12, SCREEN_WIDTH, MENU_ITEM_HEIGHT);
+  }
+  report("fillRectFast", micros() - start, iterations);
+
+  disp.clear();
+}
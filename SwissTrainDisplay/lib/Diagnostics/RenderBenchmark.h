@@ -0,0 +1,25 @@
+#ifndef RENDERBENCHMARK_H
+#define RENDERBENCHMARK_H
+
+#include <Arduino.h>
+#include "../UI/DisplayManager.h"
+
+// ====== RENDER BENCHMARK ======
+// On-target microbenchmarks for the drawing hot paths.
+// Build with -DENABLE_RENDER_BENCHMARK and watch the serial monitor.
+
+class RenderBenchmark {
+private:
+  static void report(const char* label, unsigned long elapsedUs, int iterations);
+
+public:
+  // Run all benchmarks and print results to Serial
+  static void run(DisplayManager& disp, int iterations = 500);
+
+  // Individual benchmarks
+  static void benchTextMetrics(DisplayManager& disp, int iterations);
+  static void benchLargeDigits(DisplayManager& disp, int iterations);
+  static void benchFills(DisplayManager& disp, int iterations);
+};
+
+#endif // RENDERBENCHMARK_H
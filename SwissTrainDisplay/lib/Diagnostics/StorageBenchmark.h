@@ -0,0 +1,29 @@
+#ifndef STORAGEBENCHMARK_H
+#define STORAGEBENCHMARK_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <vector>
+#include "../../include/Types.h"
+
+// ====== STORAGE BENCHMARK ======
+// On-target save/load timing of the legacy per-key preset layout versus
+// the binary preset table, journal recovery after an injected torn write
+// and a settings image restore. Uses its own Preferences namespace and journal file, both removed
+// afterwards. Build with -DENABLE_STORAGE_BENCHMARK.
+// Every iteration writes flash - keep the count small.
+
+class StorageBenchmark {
+private:
+  static void report(const char* label, unsigned long elapsedUs, int iterations);
+
+public:
+  static void run(const std::vector<Preset>& presets, int iterations = 5);
+
+  static void benchLegacyKeys(Preferences& prefs, const std::vector<Preset>& presets, int iterations);
+  static void benchPresetTable(Preferences& prefs, const std::vector<Preset>& presets, int iterations);
+  static void benchJournalRecovery(int presetCount = 100, int transactions = 20);
+  static void benchImageRestore(int presetCount = 50);
+};
+
+#endif // STORAGEBENCHMARK_H
@@ -1,100 +1,145 @@
 #include "ButtonHandler.h"
 
+// Static instance for ISR
+ButtonHandler* ButtonHandler::instance = nullptr;
+
 ButtonHandler::ButtonHandler(int buttonPin)
-  : pin(buttonPin), lastState(HIGH), currentState(HIGH),
-    pressStartTime(0), lastDebounceTime(0),
-    isPressed(false), longPressTriggered(false), eventHandled(false) {
+  : pin(buttonPin), burstActive(false), burstLevel(HIGH), burstStart(0),
+    lastEdgeTime(0), stableLevel(HIGH), isPressed(false), longPressTriggered(false),
+    pressStartTime(0), lastShortRelease(0), lastWasShort(false) {
+  instance = this;
 }
 
 bool ButtonHandler::begin() {
   Serial.println("Initializing button...");
 
   pinMode(pin, INPUT_PULLUP);
-  currentState = digitalRead(pin);
-  lastState = currentState;
+  stableLevel = digitalRead(pin);
+  burstLevel = stableLevel;
+
+  attachInterrupt(digitalPinToInterrupt(pin), handleInterrupt, CHANGE);
 
   Serial.println("Button initialized");
   return true;
 }
 
+void IRAM_ATTR ButtonHandler::handleInterrupt() {
+  if (instance == nullptr) {
+    return;
+  }
+
+  instance->edges.push(ButtonEdge(digitalRead(instance->pin), micros()));
+}
+
+// ====== DEBOUNCE ======
+
 void ButtonHandler::update() {
-  int reading = digitalRead(pin);
+  const unsigned long debounceUs = (unsigned long)BUTTON_DEBOUNCE_MS * 1000;
+
+  // Replay captured edges in order; a gap longer than the debounce time
+  // means the previous burst settled at its last level
+  ButtonEdge edge;
+  while (edges.pop(edge)) {
+    if (burstActive && edge.timestamp - lastEdgeTime >= debounceUs) {
+      commitLevel(burstLevel, burstStart);
+      burstActive = false;
+    }
+    if (!burstActive) {
+      burstActive = true;
+      burstStart = edge.timestamp;
+    }
+    burstLevel = edge.level;
+    lastEdgeTime = edge.timestamp;
+  }
 
-  // Debouncing
-  if (reading != lastState) {
-    lastDebounceTime = millis();
+  unsigned long now = micros();
+  if (burstActive && now - lastEdgeTime >= debounceUs) {
+    // Quiet long enough - trust the pin over a possibly bouncy ISR read
+    commitLevel(digitalRead(pin), burstStart);
+    burstActive = false;
   }
 
-  if ((millis() - lastDebounceTime) > BUTTON_DEBOUNCE_MS) {
-    if (reading != currentState) {
-      currentState = reading;
-
-      // Button pressed (LOW because of pullup)
-      if (currentState == LOW) {
-        if (!isPressed) {
-          isPressed = true;
-          pressStartTime = millis();
-          longPressTriggered = false;
-          eventHandled = false;
-          Serial.println("Button pressed");
-        }
-      }
-
-      // Button released
-      if (currentState == HIGH && isPressed) {
-        Serial.println("Button released");
-        isPressed = false;
-        // Don't reset eventHandled here - let getEvent() consume it
-      }
-    }
+  // Long press fires while the button is still held
+  if (isPressed && !longPressTriggered &&
+      now - pressStartTime >= (unsigned long)LONG_PRESS_MS * 1000) {
+    longPressTriggered = true;
+    lastWasShort = false;
+    events.push(ButtonPressEvent(BUTTON_LONG_PRESS, pressStartTime, 0));
+    Serial.println("Button: LONG PRESS");
+  }
+}
 
-    // Check for long press while button is held
-    if (isPressed && !longPressTriggered && !eventHandled) {
-      if (millis() - pressStartTime >= LONG_PRESS_MS) {
-        longPressTriggered = true;
-        Serial.println("Long press threshold reached");
-      }
-    }
+void ButtonHandler::commitLevel(uint8_t level, unsigned long timestamp) {
+  if (level == stableLevel) {
+    return;  // Bounce that ended where it started
+  }
+  stableLevel = level;
+
+  // Pressed is LOW because of pullup
+  if (level == LOW) {
+    onPress(timestamp);
+  } else {
+    onRelease(timestamp);
   }
+}
 
-  lastState = reading;
+// ====== GESTURES ======
+
+void ButtonHandler::onPress(unsigned long timestamp) {
+  isPressed = true;
+  pressStartTime = timestamp;
+  longPressTriggered = false;
 }
 
-ButtonEvent ButtonHandler::getEvent() {
-  ButtonEvent event = BUTTON_NONE;
+void ButtonHandler::onRelease(unsigned long timestamp) {
+  if (!isPressed) {
+    return;
+  }
+  isPressed = false;
 
-  // Long press detected
-  if (longPressTriggered && !eventHandled) {
-    event = BUTTON_LONG_PRESS;
-    eventHandled = true;
-    Serial.println("Button: LONG PRESS event returned");
+  unsigned long duration = timestamp - pressStartTime;
+
+  // Release after a long press was already reported
+  if (longPressTriggered) {
+    return;
   }
-  // Short press detected (button released without long press)
-  else if (!isPressed && !longPressTriggered && !eventHandled && pressStartTime > 0) {
-    unsigned long pressDuration = millis() - pressStartTime;
-    if (pressDuration > BUTTON_DEBOUNCE_MS && pressDuration < LONG_PRESS_MS) {
-      event = BUTTON_SHORT_PRESS;
-      eventHandled = true;
-      pressStartTime = 0;  // Reset to prevent re-triggering
-      Serial.println("Button: SHORT PRESS event returned");
-    } else if (pressDuration >= LONG_PRESS_MS) {
-      // Was a long press but already handled, just clean up
-      eventHandled = true;
-      pressStartTime = 0;
-    }
+
+  // Long hold released before update() saw the threshold
+  if (duration >= (unsigned long)LONG_PRESS_MS * 1000) {
+    lastWasShort = false;
+    events.push(ButtonPressEvent(BUTTON_LONG_PRESS, pressStartTime, duration));
+    Serial.println("Button: LONG PRESS");
+    return;
+  }
+
+  // Second tap soon after a first one
+  if (lastWasShort && pressStartTime - lastShortRelease <= (unsigned long)DOUBLE_PRESS_MS * 1000) {
+    lastWasShort = false;
+    events.push(ButtonPressEvent(BUTTON_DOUBLE_PRESS, pressStartTime, duration));
+    Serial.println("Button: DOUBLE PRESS");
+    return;
   }
 
-  return event;
+  lastWasShort = true;
+  lastShortRelease = timestamp;
+  events.push(ButtonPressEvent(BUTTON_SHORT_PRESS, pressStartTime, duration));
+  Serial.println("Button: SHORT PRESS");
 }
 
-bool ButtonHandler::hasEvent() const {
-  return (longPressTriggered && !eventHandled) ||
-         (!isPressed && !longPressTriggered && !eventHandled && pressStartTime > 0);
+// ====== EVENTS ======
+
+bool ButtonHandler::popEvent(ButtonPressEvent& event) {
+  return events.pop(event);
+}
+
+ButtonEvent ButtonHandler::getEvent() {
+  ButtonPressEvent event;
+  return popEvent(event) ? event.type : BUTTON_NONE;
 }
 
 unsigned long ButtonHandler::getPressDuration() const {
   if (!isPressed) {
     return 0;
   }
-  return millis() - pressStartTime;
+  return (micros() - pressStartTime) / 1000;
 }
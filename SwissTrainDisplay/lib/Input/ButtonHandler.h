@@ -4,17 +4,44 @@
 #include <Arduino.h>
 #include "../../include/Config.h"
 #include "../../include/Types.h"
+#include "EventQueue.h"
+
+// Interrupt-driven button: the ISR timestamps every raw edge, update()
+// debounces them by their timestamps (a level counts once it held for
+// BUTTON_DEBOUNCE_MS) and turns press/release pairs into gestures.
+// Timing therefore doesn't depend on how often update() runs.
 
 class ButtonHandler {
 private:
+  static ButtonHandler* instance;  // For ISR
+
   int pin;
-  int lastState;
-  int currentState;
-  unsigned long pressStartTime;
-  unsigned long lastDebounceTime;
+
+  // Raw edges from the ISR
+  EventQueue<ButtonEdge, BUTTON_EDGE_QUEUE_SIZE> edges;
+
+  // Debounce state (consumer side)
+  bool burstActive;            // Edges seen, level not yet settled
+  uint8_t burstLevel;
+  unsigned long burstStart;    // First edge of the burst
+  unsigned long lastEdgeTime;
+  uint8_t stableLevel;
+
+  // Gesture state
   bool isPressed;
   bool longPressTriggered;
-  bool eventHandled;
+  unsigned long pressStartTime;    // micros() of debounced press
+  unsigned long lastShortRelease;  // micros() of last short press release
+  bool lastWasShort;
+
+  // Debounced gestures for consumers
+  EventQueue<ButtonPressEvent, BUTTON_EVENT_QUEUE_SIZE> events;
+
+  static void IRAM_ATTR handleInterrupt();
+
+  void commitLevel(uint8_t level, unsigned long timestamp);
+  void onPress(unsigned long timestamp);
+  void onRelease(unsigned long timestamp);
 
 public:
   ButtonHandler(int buttonPin = ENCODER_SW);
@@ -22,16 +49,19 @@ public:
   // Initialize
   bool begin();
 
-  // Update - call in loop()
+  // Update - call periodically (debounce + long press detection)
   void update();
 
   // Check for events
+  bool popEvent(ButtonPressEvent& event);
   ButtonEvent getEvent();
-  bool hasEvent() const;
+  bool hasEvent() const { return !events.isEmpty(); }
+  bool hasPendingEdges() const { return !edges.isEmpty(); }
+  uint32_t getDroppedEdges() const { return edges.getDropped(); }
 
   // State queries
   bool isPressedNow() const { return isPressed; }
-  unsigned long getPressDuration() const;
+  unsigned long getPressDuration() const;  // Milliseconds
 };
 
 #endif // BUTTONHANDLER_H
@@ -4,8 +4,8 @@
 EncoderHandler* EncoderHandler::instance = nullptr;
 
 EncoderHandler::EncoderHandler()
-  : position(0), rawCount(0), lastEncoded(0),
-    lastInterruptTime(0), lastReadPosition(0) {
+  : position(0), rawCount(0), lastEncoded(0), lastInterruptTime(0),
+    lastEventTime(0), lastIntervalUs(0), lastDirection(0) {
   instance = this;
 }
 
@@ -51,29 +51,100 @@ void IRAM_ATTR EncoderHandler::handleInterrupt() {
   }
 
   // Update position (one position per 2 raw counts = one per detent/click)
-  instance->position = instance->rawCount / 2;
+  int newPosition = instance->rawCount / 2;
+  int oldPosition = instance->position;
+  instance->position = newPosition;
+
+  // Queue one event per detent so fast spins stay ordered and lossless
+  if (newPosition != oldPosition) {
+    int8_t step = (newPosition > oldPosition) ? 1 : -1;
+    unsigned long now = micros();
+    for (int p = oldPosition; p != newPosition; p += step) {
+      instance->events.push(EncoderEvent(step, p + step, now));
+    }
+  }
 
   instance->lastEncoded = encoded;
 }
 
+// ====== EVENT QUEUE ======
+
+bool EncoderHandler::popEvent(EncoderEvent& event) {
+  if (!events.pop(event)) {
+    return false;
+  }
+  trackEvent(event);
+  return true;
+}
+
+void EncoderHandler::trackEvent(const EncoderEvent& event) {
+  // Track rotation speed from consecutive detents
+  if (lastEventTime != 0 && event.delta == lastDirection) {
+    // Detents queued by one interrupt share a timestamp; they belong to
+    // the same spin, so keep its speed instead of dropping to one step
+    if (event.timestamp != lastEventTime) {
+      lastIntervalUs = event.timestamp - lastEventTime;
+    }
+  } else {
+    lastIntervalUs = 0;  // First detent or direction change
+  }
+  lastEventTime = event.timestamp;
+  lastDirection = event.delta;
+}
+
 int EncoderHandler::getDelta() {
-  int delta = position - lastReadPosition;
-  lastReadPosition = position;
+  int delta = 0;
+  EncoderEvent event;
+  while (popEvent(event)) {
+    delta += event.delta;
+  }
   return delta;
 }
 
+float EncoderHandler::getSpeed() const {
+  if (lastIntervalUs == 0 ||
+      micros() - lastEventTime > (unsigned long)ENCODER_SPEED_TIMEOUT_MS * 1000) {
+    return 0.0f;
+  }
+  return lastDirection * (1000000.0f / lastIntervalUs);
+}
+
 void EncoderHandler::resetPosition() {
-  noInterrupts();
-  position = 0;
-  rawCount = 0;
-  lastReadPosition = 0;
-  interrupts();
+  setPosition(0);
 }
 
 void EncoderHandler::setPosition(int pos) {
   noInterrupts();
   position = pos;
   rawCount = pos * 2;
-  lastReadPosition = pos;
+  events.clear();
   interrupts();
+  lastEventTime = 0;
+  lastIntervalUs = 0;
+}
+
+// ====== ACCELERATION ======
+
+int EncoderHandler::getAcceleratedDelta(const EncoderEvent& event) const {
+  return accelerate(event.delta, lastIntervalUs, accelCurve);
+}
+
+int EncoderHandler::accelerate(int delta, unsigned long intervalUs, const AccelerationCurve& curve) {
+  // No interval (first detent, direction change) or too slow: one step
+  if (intervalUs == 0 || curve.maxMultiplier <= 1 || curve.maxDps <= curve.minDps) {
+    return delta;
+  }
+
+  unsigned long dps = 1000000UL / intervalUs;
+  if (dps <= curve.minDps) {
+    return delta;
+  }
+  if (dps >= curve.maxDps) {
+    return delta * curve.maxMultiplier;
+  }
+
+  // Linear ramp between minDps and maxDps
+  unsigned long range = curve.maxDps - curve.minDps;
+  int multiplier = 1 + ((dps - curve.minDps) * (curve.maxMultiplier - 1) + range / 2) / range;
+  return delta * multiplier;
 }
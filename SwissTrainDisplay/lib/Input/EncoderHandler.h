@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include "../../include/Config.h"
 #include "../../include/Types.h"
+#include "EventQueue.h"
 
 class EncoderHandler {
 private:
@@ -14,7 +15,15 @@ private:
   volatile int lastEncoded;
   volatile unsigned long lastInterruptTime;
 
-  int lastReadPosition;
+  // Timestamped detent events, filled by the ISR and drained by the loop
+  EventQueue<EncoderEvent, ENCODER_QUEUE_SIZE> events;
+
+  // Consumer-side rotation speed tracking
+  unsigned long lastEventTime;   // micros() of last drained event
+  unsigned long lastIntervalUs;  // Time between the last two detents
+  int lastDirection;
+
+  AccelerationCurve accelCurve;
 
   // ISR function
   static void IRAM_ATTR handleInterrupt();
@@ -25,10 +34,30 @@ public:
   // Initialize pins and attach interrupts
   bool begin();
 
+  // Event queue (lossless, ordered) - drain each iteration
+  bool popEvent(EncoderEvent& event);
+  bool hasEvents() const { return !events.isEmpty(); }
+  uint32_t getDroppedEvents() const { return events.getDropped(); }
+
   // Read encoder
   int getPosition() const { return position; }
-  int getDelta();  // Get change since last read
-  bool hasChanged() const { return position != lastReadPosition; }
+  int getDelta();  // Drain queued events and return their summed delta
+  bool hasChanged() const { return hasEvents(); }
+
+  // Speed tracking for one drained event (popEvent calls it; host tests
+  // feed synthetic streams through it)
+  void trackEvent(const EncoderEvent& event);
+
+  // Rotation speed from event timestamps (detents per second, signed)
+  float getSpeed() const;
+
+  // Acceleration - screens opt in; applies to the most recently popped event
+  int getAcceleratedDelta(const EncoderEvent& event) const;
+  void setAccelerationCurve(const AccelerationCurve& curve) { accelCurve = curve; }
+  const AccelerationCurve& getAccelerationCurve() const { return accelCurve; }
+
+  // Pure curve evaluation (no hardware state), usable on the host
+  static int accelerate(int delta, unsigned long intervalUs, const AccelerationCurve& curve);
 
   // Reset position
   void resetPosition();
@@ -0,0 +1,58 @@
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include <Arduino.h>
+
+// ====== SPSC EVENT QUEUE ======
+// Lock-free single-producer / single-consumer ring buffer.
+// The producer (an ISR) only writes `head`, the consumer (loop) only
+// writes `tail`, so no critical section is needed on the single-core
+// ESP8266. push() is forced inline so it lands in the caller's IRAM.
+// Capacity must be a power of two; one slot is kept free.
+
+template <typename T, uint8_t CAPACITY>
+class EventQueue {
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "EventQueue capacity must be a power of two");
+
+private:
+  T items[CAPACITY];
+  volatile uint8_t head;      // Next slot to write (producer)
+  volatile uint8_t tail;      // Next slot to read (consumer)
+  volatile uint32_t dropped;  // Events lost because the queue was full
+
+public:
+  EventQueue() : head(0), tail(0), dropped(0) {}
+
+  // Producer side (ISR)
+  __attribute__((always_inline)) inline bool push(const T& item) {
+    uint8_t next = (head + 1) & (CAPACITY - 1);
+    if (next == tail) {
+      dropped = dropped + 1;
+      return false;
+    }
+    items[head] = item;
+    __asm__ __volatile__("" ::: "memory");  // Publish item before head
+    head = next;
+    return true;
+  }
+
+  // Consumer side (loop)
+  bool pop(T& item) {
+    if (tail == head) {
+      return false;
+    }
+    item = items[tail];
+    __asm__ __volatile__("" ::: "memory");  // Read item before freeing slot
+    tail = (tail + 1) & (CAPACITY - 1);
+    return true;
+  }
+
+  bool isEmpty() const { return tail == head; }
+  uint8_t size() const { return (head - tail) & (CAPACITY - 1); }
+  uint32_t getDropped() const { return dropped; }
+
+  // Consumer-side discard of everything queued
+  void clear() { tail = head; }
+};
+
+#endif // EVENTQUEUE_H
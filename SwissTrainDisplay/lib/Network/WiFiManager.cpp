@@ -1,34 +1,82 @@
 #include "WiFiManager.h"
+#include <algorithm>
 
-WiFiManager::WiFiManager()
-  : currentSSID(""), currentPassword(""), isConnecting(false) {
+WiFiManager::WiFiManager(SettingsManager* settingsMgr)
+  : currentSSID(""), currentPassword(""), settings(settingsMgr), connectState(WIFI_STATE_IDLE),
+    connectStart(0), attemptStart(0), connectTimeout(WIFI_CONNECT_TIMEOUT_MS), onConnected(nullptr),
+    gotIPEvent(false), disconnectedEvent(false),
+    scanning(false), scanStart(0), scanResult(-1),
+    fastPath(false), lastTimeToIP(0), lastConnectFast(false),
+    linkUp(false), downSince(0), nextRetryAt(0), backoffMs(WIFI_RECONNECT_MIN_MS) {
   clearError();
   WiFi.mode(WIFI_STA);
 }
 
+void WiFiManager::begin() {
+  // The supervisor owns retry policy; credentials live in SettingsManager
+  WiFi.setAutoReconnect(false);
+  WiFi.persistent(false);
+
+#ifdef ESP8266
+  // Handlers only raise flags; poll() does the work on the loop side
+  gotIPHandler = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP&) {
+    gotIPEvent = true;
+  });
+  disconnectedHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected&) {
+    disconnectedEvent = true;
+  });
+#endif
+}
+
 // ====== SCANNING ======
 
-bool WiFiManager::scan() {
+bool WiFiManager::startScan() {
+  if (scanning) {
+    return true;  // Already running - results arrive through poll()
+  }
+
   clearError();
-  networks.clear();
+
+  // A pending association would fight the scan for the radio
+  cancelConnect();
 
   Serial.println("Scanning WiFi networks...");
+  scanning = true;
+  scanStart = millis();
+  scanResult = -1;
 
-  WiFi.disconnect();
-  delay(100);
+#ifdef ESP8266
+  WiFi.scanNetworksAsync([this](int count) {
+    scanResult = count;
+  });
+#else
+  WiFi.scanNetworks(true);
+#endif
+  return true;
+}
+
+int WiFiManager::getScanProgress() const {
+  if (!scanning) {
+    return 0;
+  }
+  // The SDK reports no progress; estimate and stall just short of done
+  unsigned long elapsed = millis() - scanStart;
+  return min(95, (int)(elapsed * 100 / WIFI_SCAN_EXPECTED_MS));
+}
 
-  int n = WiFi.scanNetworks();
+void WiFiManager::collectScanResults(int count) {
+  scanning = false;
 
-  if (n < 0) {
+  if (count < 0) {
     lastError = ErrorInfo(ERROR_WIFI_SCAN, "WiFi scan failed");
     Serial.println("WiFi scan failed");
-    return false;
+    WiFi.scanDelete();
+    return;
   }
 
-  Serial.printf("Found %d networks\n", n);
-
-  int maxNetworks = min(n, WIFI_SCAN_MAX_NETWORKS);
-  for (int i = 0; i < maxNetworks; i++) {
+  networks.clear();
+  networks.reserve(count);
+  for (int i = 0; i < count; i++) {
     WiFiNetwork network;
     network.ssid = WiFi.SSID(i);
     network.rssi = WiFi.RSSI(i);
@@ -37,14 +85,50 @@ bool WiFiManager::scan() {
 #elif defined(ESP8266)
     network.isSecure = (WiFi.encryptionType(i) != AUTH_OPEN);
 #endif
-
     networks.push_back(network);
+  }
+  WiFi.scanDelete();  // Free the SDK's result list
+
+  dedupeAndSort(networks);
+
+  Serial.printf("Found %d networks (%d unique) in %lu ms\n",
+                count, (int)networks.size(), millis() - scanStart);
+  for (size_t i = 0; i < networks.size(); i++) {
     Serial.printf("  %d: %s (%d dBm) %s\n",
-                  i, network.ssid.c_str(), network.rssi,
-                  network.isSecure ? "[Secure]" : "[Open]");
+                  (int)i, networks[i].ssid.c_str(), networks[i].rssi,
+                  networks[i].isSecure ? "[Secure]" : "[Open]");
   }
+}
 
-  return true;
+void WiFiManager::dedupeAndSort(std::vector<WiFiNetwork>& list) {
+  // Strongest first, so the first entry of each SSID is the one to keep
+  std::sort(list.begin(), list.end(), [](const WiFiNetwork& a, const WiFiNetwork& b) {
+    return a.rssi > b.rssi;
+  });
+
+  std::vector<WiFiNetwork> unique;
+  unique.reserve(list.size());
+  for (const WiFiNetwork& network : list) {
+    if (network.ssid.length() == 0) {
+      continue;  // Hidden network
+    }
+
+    bool seen = false;
+    for (const WiFiNetwork& kept : unique) {
+      if (kept.ssid == network.ssid) {
+        seen = true;  // Another AP of the same mesh / extender
+        break;
+      }
+    }
+    if (!seen) {
+      unique.push_back(network);
+      if ((int)unique.size() >= WIFI_SCAN_MAX_NETWORKS) {
+        break;
+      }
+    }
+  }
+
+  list.swap(unique);
 }
 
 const WiFiNetwork* WiFiManager::getNetwork(int index) const {
@@ -57,48 +141,232 @@ const WiFiNetwork* WiFiManager::getNetwork(int index) const {
 // ====== CONNECTION ======
 
 bool WiFiManager::connect(const String& ssid, const String& password, unsigned long timeout) {
+  if (ssid.length() == 0) {
+    lastError = ErrorInfo(ERROR_WIFI_CONNECT, "No SSID");
+    return false;
+  }
+
   clearError();
-  isConnecting = true;
+  pendingSSID = ssid;
+  pendingPassword = password;
+  connectTimeout = timeout;
+  attemptStart = millis();
+  connectState = WIFI_STATE_CONNECTING;
+
+  // Cached association data only applies to the network it came from
+  if (!settings || !settings->loadWiFiFastConnect(fastData) || fastData.ssidHash != hashSSID(ssid)) {
+    fastData = WiFiFastConnect();
+  }
+  fastPath = fastData.hasAssociation();
 
   Serial.println("Connecting to: " + ssid);
+  beginAttempt();
+  return true;
+}
 
-  WiFi.begin(ssid.c_str(), password.c_str());
+void WiFiManager::beginAttempt() {
+  connectStart = millis();
+  gotIPEvent = false;
+  disconnectedEvent = false;
 
-  unsigned long startTime = millis();
-  while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < timeout) {
-    delay(500);
-    Serial.print(".");
+  applyAddressConfig();
+
+  if (fastPath) {
+    // Known AP and channel - skips the full scan
+    const uint8_t* b = fastData.bssid;
+    Serial.printf("Fast connect: ch %d, BSSID %02X:%02X:%02X:%02X:%02X:%02X\n",
+                  (int)fastData.channel, b[0], b[1], b[2], b[3], b[4], b[5]);
+    WiFi.begin(pendingSSID.c_str(), pendingPassword.c_str(), fastData.channel, fastData.bssid);
+  } else {
+    WiFi.begin(pendingSSID.c_str(), pendingPassword.c_str());
   }
-  Serial.println();
+}
 
-  isConnecting = false;
+void WiFiManager::applyAddressConfig() {
+  // Static IP always applies; a cached lease only on the fast path
+  bool useCached = fastData.hasAddress() && (fastData.staticIP || (fastPath && WIFI_REUSE_DHCP_LEASE));
 
-  if (WiFi.status() != WL_CONNECTED) {
-    lastError = ErrorInfo(ERROR_WIFI_CONNECT, "Connection timeout", ssid);
-    Serial.println("Connection failed: timeout");
-    return false;
+  if (useCached) {
+    WiFi.config(IPAddress(fastData.ip), IPAddress(fastData.gateway),
+                IPAddress(fastData.subnet), IPAddress(fastData.dns));
+  } else {
+    // All-zero config switches DHCP back on
+    WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
   }
+}
 
-  currentSSID = ssid;
-  currentPassword = password;
+WiFiConnectState WiFiManager::poll() {
+  if (scanning) {
+#ifdef ESP8266
+    int result = scanResult;
+#else
+    int result = WiFi.scanComplete();
+    if (result == WIFI_SCAN_RUNNING) {
+      result = -1;
+    }
+#endif
+    if (result >= 0) {
+      collectScanResults(result);
+    } else if (millis() - scanStart >= WIFI_SCAN_TIMEOUT_MS) {
+      collectScanResults(-1);
+    }
+  }
 
-  Serial.println("WiFi connected!");
+  if (connectState != WIFI_STATE_CONNECTING) {
+    return connectState;
+  }
+
+  // Event flag first; status() covers platforms without station events
+  if (gotIPEvent || WiFi.status() == WL_CONNECTED) {
+    gotIPEvent = false;
+    finishConnect();
+  } else if (fastPath && millis() - connectStart >= WIFI_FAST_CONNECT_TIMEOUT_MS) {
+    // AP moved or changed channel - forget it and do a full scan + DHCP
+    Serial.println("Fast connect failed, falling back to full connect");
+    bool keepStatic = fastData.staticIP;
+    WiFiFastConnect staticConfig = fastData;
+    fastData = WiFiFastConnect();
+    if (keepStatic) {
+      fastData.ip = staticConfig.ip;
+      fastData.gateway = staticConfig.gateway;
+      fastData.subnet = staticConfig.subnet;
+      fastData.dns = staticConfig.dns;
+      fastData.staticIP = true;
+    }
+    fastPath = false;
+    WiFi.disconnect();
+    beginAttempt();
+  } else if (millis() - connectStart >= connectTimeout) {
+    failConnect("Connection timeout");
+  } else if (WiFi.status() == WL_WRONG_PASSWORD) {
+    failConnect("Wrong password");
+  } else if (WiFi.status() == WL_NO_SSID_AVAIL && millis() - connectStart >= connectTimeout / 2) {
+    failConnect("Network not found");
+  }
+
+  return connectState;
+}
+
+void WiFiManager::finishConnect() {
+  connectState = WIFI_STATE_CONNECTED;
+  currentSSID = pendingSSID;
+  currentPassword = pendingPassword;
+
+  lastTimeToIP = millis() - attemptStart;
+  lastConnectFast = fastPath;
+  Serial.printf("WiFi connected in %lu ms (%s path)\n", lastTimeToIP, fastPath ? "fast" : "full");
   Serial.println("IP: " + WiFi.localIP().toString());
 
+  rememberAssociation();
+  onLinkRestored();
+
   // Configure NTP for time sync
   configTime(TIMEZONE_OFFSET_SEC, DAYLIGHT_OFFSET_SEC, NTP_SERVER1, NTP_SERVER2);
 
-  return true;
+  if (onConnected) {
+    onConnected();
+  }
+}
+
+void WiFiManager::rememberAssociation() {
+  WiFiFastConnect data = fastData;  // Keeps a static IP config
+  data.ssidHash = hashSSID(currentSSID);
+  data.channel = WiFi.channel();
+
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid) {
+    memcpy(data.bssid, bssid, sizeof(data.bssid));
+  }
+
+  if (!data.staticIP) {
+    data.ip = WiFi.localIP();
+    data.gateway = WiFi.gatewayIP();
+    data.subnet = WiFi.subnetMask();
+    data.dns = WiFi.dnsIP(0);
+  }
+
+  fastData = data;
+  if (settings) {
+    settings->saveWiFiFastConnect(data);  // No-op when unchanged
+  }
+}
+
+uint32_t WiFiManager::hashSSID(const String& ssid) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (unsigned int i = 0; i < ssid.length(); i++) {
+    hash ^= (uint8_t)ssid[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void WiFiManager::failConnect(const String& reason) {
+  WiFi.disconnect();
+  connectState = WIFI_STATE_FAILED;
+  lastError = ErrorInfo(ERROR_WIFI_CONNECT, reason, pendingSSID);
+  Serial.println("Connection failed: " + reason);
+}
+
+void WiFiManager::cancelConnect() {
+  if (connectState != WIFI_STATE_CONNECTING) {
+    return;
+  }
+  WiFi.disconnect();
+  connectState = WIFI_STATE_CANCELLED;
+  Serial.println("Connection cancelled");
+}
+
+int WiFiManager::getConnectProgress() const {
+  if (connectState != WIFI_STATE_CONNECTING || connectTimeout == 0) {
+    return connectState == WIFI_STATE_CONNECTED ? 100 : 0;
+  }
+  unsigned long elapsed = millis() - connectStart;
+  return min(100, (int)(elapsed * 100 / connectTimeout));
 }
 
 bool WiFiManager::disconnect() {
   Serial.println("Disconnecting WiFi");
+  cancelConnect();
   WiFi.disconnect();
+  linkUp = false;  // Intentional - not a link loss
   currentSSID = "";
   currentPassword = "";
   return true;
 }
 
+// ====== FAST RECONNECT ======
+
+bool WiFiManager::setStaticIP(const IPAddress& ip, const IPAddress& gateway,
+                              const IPAddress& subnet, const IPAddress& dns) {
+  if (currentSSID.length() == 0) {
+    lastError = ErrorInfo(ERROR_WIFI_CONNECT, "Connect before setting a static IP");
+    return false;
+  }
+
+  fastData.ssidHash = hashSSID(currentSSID);
+  fastData.ip = ip;
+  fastData.gateway = gateway;
+  fastData.subnet = subnet;
+  fastData.dns = dns;
+  fastData.staticIP = true;
+
+  Serial.println("Static IP set: " + ip.toString());
+  return settings ? settings->saveWiFiFastConnect(fastData) : true;
+}
+
+bool WiFiManager::clearStaticIP() {
+  // Back to DHCP; the next full connect captures a fresh lease
+  fastData.staticIP = false;
+  fastData.ip = 0;
+  fastData.gateway = 0;
+  fastData.subnet = 0;
+  fastData.dns = 0;
+
+  Serial.println("Static IP cleared, using DHCP");
+  return settings ? settings->saveWiFiFastConnect(fastData) : true;
+}
+
 // ====== INFO ======
 
 String WiFiManager::getIP() const {
@@ -126,6 +394,95 @@ bool WiFiManager::autoReconnect() {
     return false;  // No credentials to reconnect with
   }
 
+  if (connectState == WIFI_STATE_CONNECTING) {
+    return false;  // Attempt already in flight
+  }
+
   Serial.println("Auto-reconnecting to WiFi...");
-  return connect(currentSSID, currentPassword);
+  connect(currentSSID, currentPassword);  // Fast path if the AP is unchanged
+  return false;  // Result arrives through poll()
+}
+
+void WiFiManager::setCredentials(const String& ssid, const String& password) {
+  currentSSID = ssid;
+  currentPassword = password;
+}
+
+void WiFiManager::supervise() {
+  // Attempts in flight report their own disconnect events
+  if (connectState == WIFI_STATE_CONNECTING || scanning) {
+    disconnectedEvent = false;
+    return;
+  }
+
+  bool connected = WiFi.status() == WL_CONNECTED;
+
+  if (linkUp && (disconnectedEvent || !connected)) {
+    disconnectedEvent = false;
+    onLinkLost();
+  } else if (!linkUp && connected && currentSSID.length() > 0) {
+    onLinkRestored();  // Came back without our help
+  }
+  disconnectedEvent = false;
+
+  // Saved network unreachable at boot - keep trying, but not after a user cancel
+  if (!linkUp && downSince == 0 && connectState == WIFI_STATE_FAILED && currentSSID.length() > 0) {
+    downSince = millis();
+    backoffMs = WIFI_RECONNECT_MIN_MS;
+    nextRetryAt = millis() + backoffMs;
+  }
+
+  if (linkUp || downSince == 0 || currentSSID.length() == 0) {
+    return;  // Up, or never connected / intentionally disconnected
+  }
+
+  if ((long)(millis() - nextRetryAt) >= 0) {
+    reconnectStats.attempts++;
+    Serial.printf("WiFi reconnect attempt %lu (backoff %lu ms)\n",
+                  (unsigned long)reconnectStats.attempts, backoffMs);
+    autoReconnect();
+    scheduleRetry();
+  }
+}
+
+void WiFiManager::onLinkLost() {
+  linkUp = false;
+  downSince = millis();
+  backoffMs = WIFI_RECONNECT_MIN_MS;
+  reconnectStats.disconnects++;
+  Serial.println("WiFi link lost");
+
+  // First retry is still jittered so a fleet behind one AP doesn't stampede
+  nextRetryAt = millis() + backoffMs / 2 + random(backoffMs / 2 + 1);
+}
+
+void WiFiManager::onLinkRestored() {
+  if (!linkUp && downSince != 0) {
+    uint32_t downtime = millis() - downSince;
+    reconnectStats.reconnects++;
+    reconnectStats.lastDowntimeMs = downtime;
+    reconnectStats.totalDowntimeMs += downtime;
+    if (downtime > reconnectStats.longestDowntimeMs) {
+      reconnectStats.longestDowntimeMs = downtime;
+    }
+    Serial.printf("WiFi link restored after %lu ms\n", (unsigned long)downtime);
+  }
+
+  linkUp = true;
+  downSince = 0;
+  backoffMs = WIFI_RECONNECT_MIN_MS;
+}
+
+void WiFiManager::scheduleRetry() {
+  // Exponential backoff with equal jitter: wait in [backoff/2, backoff]
+  backoffMs = min((unsigned long)WIFI_RECONNECT_MAX_MS, backoffMs * 2);
+  nextRetryAt = millis() + backoffMs / 2 + random(backoffMs / 2 + 1);
+}
+
+unsigned long WiFiManager::getNextRetryIn() const {
+  if (linkUp || downSince == 0) {
+    return 0;
+  }
+  long remaining = (long)(nextRetryAt - millis());
+  return remaining > 0 ? remaining : 0;
 }
@@ -10,6 +10,26 @@
 #include <vector>
 #include "../../include/Config.h"
 #include "../../include/Types.h"
+#include "../Storage/SettingsManager.h"
+
+// ====== RECONNECT STATISTICS ======
+// Link losses and recovery, for field diagnostics
+
+struct WiFiReconnectStats {
+  uint32_t disconnects;        // Link losses noticed
+  uint32_t attempts;           // Reconnect attempts started by the supervisor
+  uint32_t reconnects;         // Link restored after a loss
+  uint32_t totalDowntimeMs;
+  uint32_t longestDowntimeMs;
+  uint32_t lastDowntimeMs;
+
+  WiFiReconnectStats()
+    : disconnects(0), attempts(0), reconnects(0),
+      totalDowntimeMs(0), longestDowntimeMs(0), lastDowntimeMs(0) {}
+};
+
+// Called from poll() once a connection attempt gets an IP
+typedef void (*WiFiConnectedCallback)();
 
 class WiFiManager {
 private:
@@ -17,22 +37,90 @@ private:
   String currentSSID;
   String currentPassword;
   ErrorInfo lastError;
-  bool isConnecting;
+  SettingsManager* settings;
+
+  // Connection state machine
+  WiFiConnectState connectState;
+  String pendingSSID;
+  String pendingPassword;
+  unsigned long connectStart;     // Start of the current phase (fast or full)
+  unsigned long attemptStart;     // Start of the whole attempt, for time-to-IP
+  unsigned long connectTimeout;
+  WiFiConnectedCallback onConnected;
+
+  // Set from WiFi event callbacks, consumed by poll()
+  volatile bool gotIPEvent;
+  volatile bool disconnectedEvent;
+#ifdef ESP8266
+  WiFiEventHandler gotIPHandler;
+  WiFiEventHandler disconnectedHandler;
+#endif
+
+  // Async scan
+  bool scanning;
+  unsigned long scanStart;
+  volatile int scanResult;  // Set by the scan callback, -1 while running
+  void collectScanResults(int count);
+
+  // Fast reconnect (cached BSSID/channel, lease or static IP)
+  WiFiFastConnect fastData;
+  bool fastPath;
+  unsigned long lastTimeToIP;
+  bool lastConnectFast;
+
+  void beginAttempt();
+  void applyAddressConfig();
+  void rememberAssociation();
+  static uint32_t hashSSID(const String& ssid);
+
+  // Reconnect supervisor
+  bool linkUp;
+  unsigned long downSince;
+  unsigned long nextRetryAt;
+  unsigned long backoffMs;
+  WiFiReconnectStats reconnectStats;
+
+  void onLinkLost();
+  void onLinkRestored();
+  void scheduleRetry();
+
+  void finishConnect();
+  void failConnect(const String& reason);
 
 public:
-  WiFiManager();
+  WiFiManager(SettingsManager* settingsMgr = nullptr);
 
-  // Scanning
-  bool scan();
+  // Scanning (non-blocking: start, then poll)
+  bool startScan();
+  bool isScanning() const { return scanning; }
+  int getScanProgress() const;  // 0-100, estimated from elapsed time
+  static void dedupeAndSort(std::vector<WiFiNetwork>& list);
   int getNetworkCount() const { return networks.size(); }
   const WiFiNetwork* getNetwork(int index) const;
   const std::vector<WiFiNetwork>& getNetworks() const { return networks; }
 
-  // Connection
+  // Register WiFi event handlers (call once from setup)
+  void begin();
+
+  // Connection (non-blocking: start, then poll)
   bool connect(const String& ssid, const String& password, unsigned long timeout = WIFI_CONNECT_TIMEOUT_MS);
+  WiFiConnectState poll();      // Advances connect and scan
+
+  void cancelConnect();
   bool disconnect();
   bool isConnected() const { return WiFi.status() == WL_CONNECTED; }
-  bool isConnectingNow() const { return isConnecting; }
+  bool isConnectingNow() const { return connectState == WIFI_STATE_CONNECTING; }
+  WiFiConnectState getConnectState() const { return connectState; }
+  int getConnectProgress() const;  // 0-100, elapsed share of the timeout
+  const String& getPendingSSID() const { return pendingSSID; }
+  void setOnConnected(WiFiConnectedCallback callback) { onConnected = callback; }
+
+  // Fast reconnect
+  bool setStaticIP(const IPAddress& ip, const IPAddress& gateway, const IPAddress& subnet, const IPAddress& dns);
+  bool clearStaticIP();
+  const WiFiFastConnect& getFastConnectData() const { return fastData; }
+  unsigned long getLastTimeToIP() const { return lastTimeToIP; }
+  bool wasLastConnectFast() const { return lastConnectFast; }
 
   // Info
   String getSSID() const { return currentSSID; }
@@ -45,7 +133,12 @@ public:
   void clearError() { lastError = ErrorInfo(); }
 
   // Auto-reconnect
-  bool autoReconnect();
+  void setCredentials(const String& ssid, const String& password);  // Network to keep up
+  bool autoReconnect();  // Start an attempt with the last good credentials
+  void supervise();      // Call periodically: detect link loss, retry with backoff
+  const WiFiReconnectStats& getReconnectStats() const { return reconnectStats; }
+  unsigned long getCurrentDowntime() const { return linkUp || downSince == 0 ? 0 : millis() - downSince; }
+  unsigned long getNextRetryIn() const;
 };
 
 #endif // WIFIMANAGER_H
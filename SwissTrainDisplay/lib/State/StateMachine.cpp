@@ -6,7 +6,10 @@ StateMachine::StateMachine(DisplayManager* disp, EncoderHandler* enc, ButtonHand
   : display(disp), encoder(enc), button(btn), presets(presetMgr),
     trainAPI(api), wifi(wifiMgr), settings(settingsMgr),
     currentState(STATE_MAIN_DISPLAY), currentScreen(nullptr),
-    selectedSSID(""), selectedNetworkIndex(0) {
+    selectedSSID(""), selectedNetworkIndex(0),
+    redrawPending(false), frameIntervalMs(0), lastFrameTime(0), lastStatsTime(0),
+    inputPending(false), pendingInputTime(0), pendingInputState(STATE_MAIN_DISPLAY) {
+  setMaxFps(MAX_FPS);
 }
 
 StateMachine::~StateMachine() {
@@ -29,6 +32,7 @@ void StateMachine::begin() {
   screens[STATE_PRESET_EDIT] = new PresetEditScreen(display, presets);
   screens[STATE_PRESET_SELECT] = new PresetSelectScreen(display, presets);
   screens[STATE_ERROR] = new ErrorScreen(display);
+  screens[STATE_STORAGE_INFO] = new StorageScreen(display, settings);
 
   // Set initial state
   setState(STATE_MAIN_DISPLAY);
@@ -37,37 +41,64 @@ void StateMachine::begin() {
 }
 
 void StateMachine::update() {
+  handleInput();
+  render();
+}
+
+void StateMachine::handleInput() {
   if (!currentScreen) {
     return;
   }
 
-  bool needsRedraw = false;
+  // Advance a pending WiFi connection or scan; screens read the result in update()
+  WiFiConnectState wifiBefore = wifi->getConnectState();
+  bool scanningBefore = wifi->isScanning();
+  if (wifi->poll() != wifiBefore || wifi->isScanning() != scanningBefore) {
+    invalidate();
+  }
 
   // Update current screen (may set internal redraw flag)
   currentScreen->update();
 
   // Check if screen requested redraw (e.g., clock ticking)
   if (currentScreen->needsRedrawNow()) {
-    needsRedraw = true;
+    invalidate();
     currentScreen->clearRedrawFlag();
   }
 
-  // Handle input
-  int encoderDelta = encoder->getDelta();
-  if (encoderDelta != 0) {
-    Serial.print("Encoder delta: ");
-    Serial.println(encoderDelta);
-    currentScreen->handleEncoder(encoderDelta);
-    needsRedraw = true;  // Redraw when encoder moves
+  // Handle input - drain every queued detent in order
+  EncoderEvent encoderEvent;
+  while (encoder->popEvent(encoderEvent)) {
+    int delta = currentScreen->wantsEncoderAcceleration()
+                  ? encoder->getAcceleratedDelta(encoderEvent)
+                  : encoderEvent.delta;
+    currentScreen->handleEncoder(delta);
+    noteInput(encoderEvent.timestamp);
+    invalidate();  // Redraw when encoder moves
+
+    // A detent may trigger a transition; later detents belong to the next screen
+    if (currentScreen->hasStateChangeRequest()) {
+      break;
+    }
   }
 
-  ButtonEvent buttonEvent = button->getEvent();
-  if (buttonEvent == BUTTON_SHORT_PRESS) {
-    currentScreen->handleShortPress();
-    needsRedraw = true;  // Redraw on button press
-  } else if (buttonEvent == BUTTON_LONG_PRESS) {
-    currentScreen->handleLongPress();
-    needsRedraw = true;  // Redraw on button press
+  // One gesture per pass so a transition lands before the next one
+  ButtonPressEvent buttonEvent;
+  if (!currentScreen->hasStateChangeRequest() && button->popEvent(buttonEvent)) {
+    if (buttonEvent.type == BUTTON_SHORT_PRESS) {
+      currentScreen->handleShortPress();
+    } else if (buttonEvent.type == BUTTON_DOUBLE_PRESS) {
+      currentScreen->handleDoublePress();
+    } else if (buttonEvent.type == BUTTON_LONG_PRESS) {
+      currentScreen->handleLongPress();
+    }
+
+    // Short/double presses act on release, long presses at the threshold
+    unsigned long inputTime = buttonEvent.type == BUTTON_LONG_PRESS
+                                ? buttonEvent.pressTime + (unsigned long)LONG_PRESS_MS * 1000
+                                : buttonEvent.pressTime + buttonEvent.duration;
+    noteInput(inputTime);
+    invalidate();  // Redraw on button press
   }
 
   // Check for state change request
@@ -105,12 +136,16 @@ void StateMachine::update() {
     }
 
     setState(nextState);
-    needsRedraw = true;  // Redraw on state change
   }
+}
 
-  // Draw only when something changed
-  if (needsRedraw) {
-    currentScreen->draw();
+void StateMachine::render() {
+  // Draw only when something changed, at most once per frame slot
+  renderIfDue();
+
+  if (RENDER_STATS_INTERVAL_MS > 0 && millis() - lastStatsTime >= RENDER_STATS_INTERVAL_MS) {
+    lastStatsTime = millis();
+    printRenderStats();
   }
 }
 
@@ -137,6 +172,89 @@ void StateMachine::setState(AppState newState) {
   // Enter new screen
   currentScreen->enter();
 
-  // Draw the new screen immediately
+  // Draw the new screen in the next frame slot
+  invalidate();
+}
+
+// ====== RENDER SCHEDULING ======
+
+void StateMachine::noteInput(unsigned long timestamp) {
+  // Several inputs in one frame: measure from the oldest
+  if (inputPending) {
+    return;
+  }
+  inputPending = true;
+  pendingInputTime = timestamp;
+  pendingInputState = currentState;
+}
+
+void StateMachine::invalidate() {
+  renderStats.invalidations++;
+  if (redrawPending) {
+    renderStats.framesCoalesced++;
+  }
+  redrawPending = true;
+}
+
+void StateMachine::renderIfDue() {
+  if (!currentScreen || (!redrawPending && !currentScreen->hasDirtyRegion())) {
+    return;
+  }
+
+  unsigned long now = millis();
+  if (lastFrameTime != 0 && now - lastFrameTime < frameIntervalMs) {
+    // Keep handling input; the frame is drawn once its slot comes up
+    renderStats.framesDeferred++;
+    return;
+  }
+
+  lastFrameTime = now;
+
+  // A partial band only when nothing else changed; a full frame covers it
+  if (!redrawPending) {
+    unsigned long start = micros();
+    currentScreen->drawRegion();
+    display->showRegion(currentScreen->getDirtyY(), currentScreen->getDirtyHeight());
+    currentScreen->clearDirtyRegion();
+    unsigned long frameTime = micros() - start;
+
+    renderStats.regionFlushes++;
+    if (frameTime > renderStats.maxFrameTimeUs) {
+      renderStats.maxFrameTimeUs = frameTime;
+    }
+    return;
+  }
+
+  redrawPending = false;
+  currentScreen->clearDirtyRegion();
+
+  uint32_t flushesBefore = display->getFlushCount();
+  unsigned long start = micros();
   currentScreen->draw();
+  unsigned long frameTime = micros() - start;
+
+  // The first full frame flushed after an input is the one that shows it
+  if (inputPending && display->getFlushCount() != flushesBefore) {
+    latency.record(pendingInputState, display->getLastFlushEnd() - pendingInputTime);
+    inputPending = false;
+  }
+
+  renderStats.framesRendered++;
+  if (frameTime > renderStats.maxFrameTimeUs) {
+    renderStats.maxFrameTimeUs = frameTime;
+  }
+}
+
+void StateMachine::setMaxFps(int fps) {
+  frameIntervalMs = (fps > 0) ? 1000 / fps : 0;
+}
+
+void StateMachine::printRenderStats() const {
+  Serial.printf("Render: %lu frames, %lu partial, %lu invalidations, %lu coalesced, %lu deferred, max %lu us\n",
+                (unsigned long)renderStats.framesRendered,
+                (unsigned long)renderStats.regionFlushes,
+                (unsigned long)renderStats.invalidations,
+                (unsigned long)renderStats.framesCoalesced,
+                (unsigned long)renderStats.framesDeferred,
+                (unsigned long)renderStats.maxFrameTimeUs);
 }
@@ -13,6 +13,7 @@
 #include "../UI/Screens/PresetEditScreen.h"
 #include "../UI/Screens/PresetSelectScreen.h"
 #include "../UI/Screens/ErrorScreen.h"
+#include "../UI/Screens/StorageScreen.h"
 
 #include "../UI/DisplayManager.h"
 #include "../Input/EncoderHandler.h"
@@ -21,6 +22,23 @@
 #include "../Data/TrainAPI.h"
 #include "../Network/WiFiManager.h"
 #include "../Storage/SettingsManager.h"
+#include "../Diagnostics/LatencyTracker.h"
+
+// ====== RENDER STATISTICS ======
+// Counters for the frame-rate governor
+
+struct RenderStats {
+  uint32_t framesRendered;   // Frames actually drawn and flushed
+  uint32_t regionFlushes;    // Partial frames (marquee steps) drawn and flushed
+  uint32_t invalidations;    // Redraw requests (input, timers, state changes)
+  uint32_t framesCoalesced;  // Requests merged into an already pending frame
+  uint32_t framesDeferred;   // Loop iterations where a frame waited for its slot
+  uint32_t maxFrameTimeUs;   // Slowest draw + flush
+
+  RenderStats()
+    : framesRendered(0), regionFlushes(0), invalidations(0), framesCoalesced(0),
+      framesDeferred(0), maxFrameTimeUs(0) {}
+};
 
 class StateMachine {
 private:
@@ -42,6 +60,23 @@ private:
   String selectedSSID;
   int selectedNetworkIndex;
 
+  // Render scheduling (coalesce redraws, cap frame rate)
+  bool redrawPending;
+  unsigned long frameIntervalMs;
+  unsigned long lastFrameTime;
+  unsigned long lastStatsTime;
+  RenderStats renderStats;
+
+  // Input-to-photon latency (oldest input not yet on screen)
+  bool inputPending;
+  unsigned long pendingInputTime;  // micros() from the ISR
+  AppState pendingInputState;
+  LatencyTracker latency;
+
+  void invalidate();
+  void renderIfDue();
+  void noteInput(unsigned long timestamp);
+
 public:
   StateMachine(DisplayManager* disp, EncoderHandler* enc, ButtonHandler* btn,
                PresetManager* presetMgr, TrainAPI* api,
@@ -51,12 +86,26 @@ public:
   // Initialize and register all screens
   void begin();
 
-  // Main update loop
+  // Main update loop (handleInput + render)
   void update();
 
+  // Split steps for the task scheduler
+  void handleInput();   // Screen logic, encoder/button input, transitions
+  void render();        // Draw if invalidated and the frame slot is due
+  void requestRedraw() { invalidate(); }
+
   // Manual state transition
   void setState(AppState newState);
 
+  // Render scheduling
+  void setMaxFps(int fps);
+  int getMaxFps() const { return frameIntervalMs > 0 ? 1000 / frameIntervalMs : 0; }
+  const RenderStats& getRenderStats() const { return renderStats; }
+  void printRenderStats() const;
+
+  // Input latency
+  LatencyTracker& getLatencyTracker() { return latency; }
+
   // Getters
   AppState getCurrentState() const { return currentState; }
   Screen* getCurrentScreen() const { return currentScreen; }
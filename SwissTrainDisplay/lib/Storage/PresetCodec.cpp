@@ -0,0 +1,223 @@
+#include "PresetCodec.h"
+
+// ====== ENCODING ======
+
+void PresetCodec::putU16(std::vector<uint8_t>& out, uint16_t v) {
+  out.push_back(v & 0xFF);
+  out.push_back(v >> 8);
+}
+
+void PresetCodec::putU32(std::vector<uint8_t>& out, uint32_t v) {
+  for (int i = 0; i < 4; i++) {
+    out.push_back((v >> (8 * i)) & 0xFF);
+  }
+}
+
+void PresetCodec::putString(std::vector<uint8_t>& out, const String& s) {
+  uint8_t len = min((unsigned int)s.length(), 255u);
+  out.push_back(len);
+  for (uint8_t i = 0; i < len; i++) {
+    out.push_back((uint8_t)s[i]);
+  }
+}
+
+size_t PresetCodec::recordSize(const Preset& preset) {
+  return 3 + 3 +
+         min((unsigned int)preset.name.length(), 255u) +
+         min((unsigned int)preset.fromStation.length(), 255u) +
+         min((unsigned int)preset.toStation.length(), 255u);
+}
+
+void PresetCodec::encodeRecord(const Preset& preset, std::vector<uint8_t>& out) {
+  putU8(out, (uint8_t)preset.type);
+  putU8(out, preset.enabled ? PRESET_FLAG_ENABLED : 0);
+  putU8(out, preset.trainsToDisplay);
+  putString(out, preset.name);
+  putString(out, preset.fromStation);
+  putString(out, preset.toStation);
+}
+
+void PresetCodec::encode(const std::vector<Preset>& presets, std::vector<uint8_t>& out) {
+  std::vector<uint8_t> records;
+  for (const Preset& preset : presets) {
+    encodeRecord(preset, records);
+  }
+  wrapTable(records.data(), records.size(), presets.size(), out);
+}
+
+void PresetCodec::wrapTable(const uint8_t* records, size_t length, uint16_t count, std::vector<uint8_t>& out) {
+  out.clear();
+  out.reserve(PRESET_TABLE_HEADER_SIZE + length);
+
+  putU32(out, PRESET_TABLE_MAGIC);
+  putU8(out, PRESET_TABLE_VERSION);
+  putU8(out, PRESET_TABLE_HEADER_SIZE);
+  putU16(out, count);
+  putU32(out, length);
+  putU32(out, crc32(records, length));
+  out.insert(out.end(), records, records + length);
+}
+
+// ====== DECODING ======
+
+uint32_t PresetCodec::getU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool PresetCodec::getString(const uint8_t*& p, const uint8_t* end, String& s) {
+  if (p >= end) {
+    return false;
+  }
+  uint8_t len = *p++;
+  if (end - p < len) {
+    return false;
+  }
+  s = "";
+  s.reserve(len);
+  for (uint8_t i = 0; i < len; i++) {
+    s += (char)p[i];
+  }
+  p += len;
+  return true;
+}
+
+bool PresetCodec::decodeRecord(const uint8_t*& p, const uint8_t* end, Preset& preset) {
+  if (end - p < 3) {
+    return false;
+  }
+  preset.type = (PresetType)p[0];
+  preset.enabled = (p[1] & PRESET_FLAG_ENABLED) != 0;
+  preset.trainsToDisplay = p[2];
+  p += 3;
+
+  return getString(p, end, preset.name) &&
+         getString(p, end, preset.fromStation) &&
+         getString(p, end, preset.toStation);
+}
+
+bool PresetCodec::skipString(const uint8_t*& p, const uint8_t* end) {
+  if (p >= end || end - p - 1 < *p) {
+    return false;
+  }
+  p += 1 + *p;
+  return true;
+}
+
+bool PresetCodec::decodeSummary(const uint8_t*& p, const uint8_t* end, PresetSummary& summary) {
+  if (end - p < 3) {
+    return false;
+  }
+  summary.type = (PresetType)p[0];
+  summary.enabled = (p[1] & PRESET_FLAG_ENABLED) != 0;
+  summary.trainsToDisplay = p[2];
+  p += 3;
+
+  if (!getString(p, end, summary.label)) {
+    return false;
+  }
+
+  // Unnamed train presets are listed by route, like PresetManager::getDisplayName
+  if (summary.type == PRESET_TRAIN && summary.label.length() == 0) {
+    String from, to;
+    if (!getString(p, end, from) || !getString(p, end, to)) {
+      return false;
+    }
+    summary.label = from + "->" + to;
+    return true;
+  }
+  return skipString(p, end) && skipString(p, end);
+}
+
+bool PresetCodec::checkHeader(const uint8_t* data, size_t length, uint16_t& count, const uint8_t*& payload,
+                              const uint8_t*& end) {
+  if (length < PRESET_TABLE_HEADER_SIZE || getU32(data) != PRESET_TABLE_MAGIC) {
+    Serial.println("ERROR: Preset table has no valid header");
+    return false;
+  }
+
+  uint8_t version = data[4];
+  uint8_t headerSize = data[5];
+  uint32_t payloadSize = getU32(data + 8);
+  uint32_t storedCrc = getU32(data + 12);
+  count = getU16(data + 6);
+
+  // Newer minor versions may grow the header; the record layout is fixed per version
+  if (version != PRESET_TABLE_VERSION || headerSize < PRESET_TABLE_HEADER_SIZE) {
+    Serial.printf("ERROR: Unsupported preset table version %u\n", version);
+    return false;
+  }
+  if (headerSize + payloadSize > length) {
+    Serial.println("ERROR: Preset table truncated");
+    return false;
+  }
+
+  payload = data + headerSize;
+  end = payload + payloadSize;
+  if (crc32(payload, payloadSize) != storedCrc) {
+    Serial.println("ERROR: Preset table CRC mismatch");
+    return false;
+  }
+  return true;
+}
+
+bool PresetCodec::decode(const uint8_t* data, size_t length, std::vector<Preset>& presets) {
+  uint16_t count;
+  const uint8_t* p;
+  const uint8_t* end;
+  if (!checkHeader(data, length, count, p, end)) {
+    return false;
+  }
+
+  std::vector<Preset> decoded;
+  decoded.reserve(count);
+  for (uint16_t i = 0; i < count; i++) {
+    Preset preset;
+    if (!decodeRecord(p, end, preset)) {
+      Serial.printf("ERROR: Preset record %u malformed\n", i);
+      return false;
+    }
+    decoded.push_back(preset);
+  }
+
+  presets.swap(decoded);
+  return true;
+}
+
+bool PresetCodec::decodeSummaries(const uint8_t* data, size_t length, std::vector<PresetSummary>& summaries,
+                                  std::vector<PresetRecordSpan>& spans) {
+  uint16_t count;
+  const uint8_t* p;
+  const uint8_t* end;
+  if (!checkHeader(data, length, count, p, end)) {
+    return false;
+  }
+
+  std::vector<PresetSummary> decoded(count);
+  std::vector<PresetRecordSpan> located(count);
+  for (uint16_t i = 0; i < count; i++) {
+    const uint8_t* start = p;
+    if (!decodeSummary(p, end, decoded[i])) {
+      Serial.printf("ERROR: Preset record %u malformed\n", i);
+      return false;
+    }
+    located[i].offset = start - data;
+    located[i].length = p - start;
+  }
+
+  summaries.swap(decoded);
+  spans.swap(located);
+  return true;
+}
+
+// ====== CRC ======
+
+uint32_t PresetCodec::crc32(const uint8_t* data, size_t length, uint32_t seed) {
+  uint32_t crc = ~seed;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
@@ -0,0 +1,69 @@
+#ifndef PRESETCODEC_H
+#define PRESETCODEC_H
+
+#include <Arduino.h>
+#include <vector>
+#include "../../include/Config.h"
+#include "../../include/Types.h"
+
+// ====== PRESET TABLE BINARY FORMAT ======
+// Whole preset table in one blob, all integers little-endian:
+//
+//   header   u32 magic ("STDP")  u8 version  u8 headerSize
+//            u16 count           u32 payloadSize   u32 crc32(payload)
+//   record   u8 type  u8 flags (bit0 = enabled)  u8 trainsToDisplay
+//            u8 nameLen name[]  u8 fromLen from[]  u8 toLen to[]
+//
+// Strings are stored without terminator and truncated to 255 bytes.
+
+#define PRESET_TABLE_HEADER_SIZE 16
+#define PRESET_FLAG_ENABLED 0x01
+
+// Location of one encoded record inside a larger buffer or file
+struct PresetRecordSpan {
+  uint32_t offset;
+  uint16_t length;
+};
+
+class PresetCodec {
+private:
+  static bool skipString(const uint8_t*& p, const uint8_t* end);
+  static bool checkHeader(const uint8_t* data, size_t length, uint16_t& count, const uint8_t*& payload,
+                          const uint8_t*& end);
+
+public:
+  // Little-endian helpers, shared with PresetJournal and SettingsImage
+  static void putU8(std::vector<uint8_t>& out, uint8_t v) { out.push_back(v); }
+  static void putU16(std::vector<uint8_t>& out, uint16_t v);
+  static void putU32(std::vector<uint8_t>& out, uint32_t v);
+  static uint16_t getU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+  static uint32_t getU32(const uint8_t* p);
+  static void putString(std::vector<uint8_t>& out, const String& s);
+  static bool getString(const uint8_t*& p, const uint8_t* end, String& s);
+
+  // Serialize presets into out (replaces its contents)
+  static void encode(const std::vector<Preset>& presets, std::vector<uint8_t>& out);
+
+  // Header + already encoded records
+  static void wrapTable(const uint8_t* records, size_t length, uint16_t count, std::vector<uint8_t>& out);
+
+  // Parse a blob; false on bad magic/version/size/CRC (presets untouched)
+  static bool decode(const uint8_t* data, size_t length, std::vector<Preset>& presets);
+
+  // Same checks, but only index fields plus where each record sits in data
+  static bool decodeSummaries(const uint8_t* data, size_t length, std::vector<PresetSummary>& summaries,
+                              std::vector<PresetRecordSpan>& spans);
+
+  // Single record (no header): append to out / parse and advance p
+  static void encodeRecord(const Preset& preset, std::vector<uint8_t>& out);
+  static bool decodeRecord(const uint8_t*& p, const uint8_t* end, Preset& preset);
+  static bool decodeSummary(const uint8_t*& p, const uint8_t* end, PresetSummary& summary);
+
+  // Encoded size of one record
+  static size_t recordSize(const Preset& preset);
+
+  // CRC-32 (IEEE 802.3, reflected), chainable via seed
+  static uint32_t crc32(const uint8_t* data, size_t length, uint32_t seed = 0);
+};
+
+#endif // PRESETCODEC_H
@@ -0,0 +1,500 @@
+#include "PresetJournal.h"
+
+PresetJournal::PresetJournal(const char* filePath)
+  : path(filePath), tmpPath(String(filePath) + ".tmp"), mounted(false), nextTxn(1), fileSize(0),
+    tailDirty(false) {
+}
+
+bool PresetJournal::begin() {
+  if (mounted) {
+    return true;
+  }
+
+  mounted = LittleFS.begin();
+  if (!mounted) {
+    Serial.println("ERROR: Failed to mount LittleFS for preset journal");
+    return false;
+  }
+
+  // A leftover temp file means compaction died before the rename;
+  // the original log is still the valid one
+  if (LittleFS.exists(tmpPath)) {
+    Serial.println("Preset journal: discarding interrupted compaction");
+    LittleFS.remove(tmpPath);
+  }
+  return true;
+}
+
+bool PresetJournal::exists() {
+  return begin() && LittleFS.exists(path);
+}
+
+bool PresetJournal::remove() {
+  if (!begin()) {
+    return false;
+  }
+  fileSize = 0;
+  nextTxn = 1;
+  tailDirty = false;
+  spans.clear();
+  return !LittleFS.exists(path) || LittleFS.remove(path);
+}
+
+// ====== RECORD ENCODING ======
+
+void PresetJournal::appendRecord(std::vector<uint8_t>& out, uint8_t type, uint32_t txn,
+                                 const uint8_t* payload, size_t length) {
+  size_t start = out.size();
+  PresetCodec::putU16(out, JOURNAL_RECORD_MAGIC);
+  PresetCodec::putU8(out, type);
+  PresetCodec::putU8(out, 0);
+  PresetCodec::putU32(out, txn);
+  PresetCodec::putU32(out, length);
+  out.insert(out.end(), payload, payload + length);
+  PresetCodec::putU32(out, PresetCodec::crc32(out.data() + start, out.size() - start));
+}
+
+void PresetJournal::appendCommit(std::vector<uint8_t>& out, uint32_t txn, uint16_t count, uint16_t ops) {
+  std::vector<uint8_t> payload;
+  PresetCodec::putU16(payload, count);
+  PresetCodec::putU16(payload, ops);
+  appendRecord(out, JOURNAL_COMMIT, txn, payload.data(), payload.size());
+}
+
+void PresetJournal::appendSnapshot(std::vector<uint8_t>& out, const std::vector<uint8_t>& records,
+                                   std::vector<PresetRecordSpan>& located) {
+  std::vector<uint8_t> blob;
+  PresetCodec::wrapTable(records.data(), records.size(), located.size(), blob);
+
+  // Spans were relative to the record buffer; make them relative to out
+  uint32_t recordsAt = out.size() + JOURNAL_RECORD_HEADER_SIZE + PRESET_TABLE_HEADER_SIZE;
+  for (PresetRecordSpan& span : located) {
+    span.offset += recordsAt;
+  }
+
+  appendRecord(out, JOURNAL_SNAPSHOT, nextTxn, blob.data(), blob.size());
+  appendCommit(out, nextTxn, located.size(), 1);
+}
+
+bool PresetJournal::readSpan(File& file, const PresetRecordSpan& span, std::vector<uint8_t>& out) {
+  size_t start = out.size();
+  out.resize(start + span.length);
+  return file.seek(span.offset) && file.read(out.data() + start, span.length) == span.length;
+}
+
+// ====== WRITING ======
+
+bool PresetJournal::fitsTable(size_t tableBytes) {
+  if (tableBytes <= PRESET_TABLE_MAX_BYTES) {
+    return true;
+  }
+  Serial.printf("ERROR: Preset table too large (%d bytes, max %d)\n", (int)tableBytes, PRESET_TABLE_MAX_BYTES);
+  return false;
+}
+
+bool PresetJournal::appendTransaction(const std::vector<uint8_t>& records, uint32_t& base) {
+  File file = LittleFS.open(path, "a");
+  if (!file) {
+    Serial.println("ERROR: Failed to open preset journal");
+    return false;
+  }
+
+  // One write per transaction; a cut mid-write leaves a tail without
+  // a valid commit record, which recovery discards
+  base = file.size();
+  size_t written = file.write(records.data(), records.size());
+  file.flush();
+
+  // A short write (partition full) must not stay in front of later
+  // commits, or recovery would stop at it and drop them
+  if (written != records.size() && !file.truncate(base)) {
+    tailDirty = true;
+  }
+  fileSize = file.size();
+  file.close();
+
+  if (written != records.size()) {
+    Serial.println("ERROR: Preset journal write incomplete");
+    return false;
+  }
+
+  nextTxn++;
+  stats.commits++;
+  stats.bytesWritten += written;
+  return true;
+}
+
+bool PresetJournal::commitSnapshot(const std::vector<PresetSummary>& summaries,
+                                   const std::vector<const Preset*>& hydrated) {
+  if (!begin()) {
+    return false;
+  }
+
+  // An oversized log, or one with a partial write at its end, is replaced instead of appended to
+  return writeSnapshot(summaries, hydrated, tailDirty || fileSize >= PRESET_JOURNAL_COMPACT_BYTES);
+}
+
+bool PresetJournal::writeSnapshot(const std::vector<PresetSummary>& summaries,
+                                  const std::vector<const Preset*>& hydrated, bool replace) {
+  // Gather every record: fresh encodings for hydrated presets, raw bytes otherwise
+  std::vector<uint8_t> records;
+  std::vector<PresetRecordSpan> located(summaries.size());
+  File file;
+  for (size_t i = 0; i < summaries.size(); i++) {
+    located[i].offset = records.size();
+    const Preset* preset = i < hydrated.size() ? hydrated[i] : nullptr;
+    if (preset) {
+      PresetCodec::encodeRecord(*preset, records);
+    } else {
+      int slot = summaries[i].stored;
+      if (slot < 0 || slot >= (int)spans.size()) {
+        Serial.printf("ERROR: Preset %d has no stored record\n", (int)i);
+        return false;
+      }
+      if (!file) {
+        file = LittleFS.open(path, "r");
+      }
+      if (!file || !readSpan(file, spans[slot], records)) {
+        Serial.printf("ERROR: Failed to read stored preset %d\n", slot);
+        return false;
+      }
+    }
+    located[i].length = records.size() - located[i].offset;
+  }
+  if (file) {
+    file.close();
+  }
+  if (!fitsTable(PRESET_TABLE_HEADER_SIZE + records.size())) {
+    return false;
+  }
+
+  std::vector<uint8_t> txn;
+  appendSnapshot(txn, records, located);
+
+  if (replace) {
+    file = LittleFS.open(tmpPath, "w");
+    if (!file) {
+      Serial.println("ERROR: Failed to create preset journal temp file");
+      return false;
+    }
+    size_t written = file.write(txn.data(), txn.size());
+    file.close();
+
+    // LittleFS rename replaces the target atomically
+    if (written != txn.size() || !LittleFS.rename(tmpPath, path)) {
+      Serial.println("ERROR: Preset journal compaction failed");
+      LittleFS.remove(tmpPath);
+      return false;
+    }
+    Serial.printf("Preset journal compacted: %d -> %d bytes\n", (int)fileSize, (int)txn.size());
+    fileSize = txn.size();
+    tailDirty = false;
+    nextTxn++;
+    stats.commits++;
+    stats.compactions++;
+    stats.bytesWritten += written;
+  } else {
+    uint32_t base;
+    if (!appendTransaction(txn, base)) {
+      return false;
+    }
+    for (PresetRecordSpan& span : located) {
+      span.offset += base;
+    }
+  }
+
+  spans.swap(located);
+  Serial.printf("Preset journal: snapshot of %d presets, log %d bytes\n", (int)spans.size(), (int)fileSize);
+  return true;
+}
+
+bool PresetJournal::commitSnapshot(const std::vector<Preset>& presets) {
+  std::vector<PresetSummary> summaries(presets.size());
+  std::vector<const Preset*> hydrated(presets.size());
+  for (size_t i = 0; i < presets.size(); i++) {
+    hydrated[i] = &presets[i];
+  }
+  return commitSnapshot(summaries, hydrated);
+}
+
+bool PresetJournal::commitUpdates(const std::vector<std::pair<int, const Preset*>>& records, uint16_t count) {
+  if (!begin()) {
+    return false;
+  }
+  if (records.empty()) {
+    return true;
+  }
+  if (spans.empty()) {
+    Serial.println("ERROR: Preset journal has no base snapshot");
+    return false;
+  }
+  if (tailDirty && !compact()) {
+    return false;  // Appending after the partial write would be lost on recovery
+  }
+
+  // The table these updates produce must still compact into one snapshot
+  std::vector<size_t> lengths(count, 0);
+  for (size_t i = 0; i < spans.size() && i < count; i++) {
+    lengths[i] = spans[i].length;
+  }
+  for (const auto& record : records) {
+    if (record.first < (int)count) {
+      lengths[record.first] = PresetCodec::recordSize(*record.second);
+    }
+  }
+  size_t tableBytes = PRESET_TABLE_HEADER_SIZE;
+  for (size_t length : lengths) {
+    tableBytes += length;
+  }
+  if (!fitsTable(tableBytes)) {
+    return false;
+  }
+
+  std::vector<uint8_t> txn;
+  std::vector<uint8_t> payload;
+  std::vector<PresetRecordSpan> located(records.size());
+  for (size_t i = 0; i < records.size(); i++) {
+    payload.clear();
+    PresetCodec::putU16(payload, records[i].first);
+    PresetCodec::encodeRecord(*records[i].second, payload);
+
+    located[i].offset = txn.size() + JOURNAL_RECORD_HEADER_SIZE + 2;
+    located[i].length = payload.size() - 2;
+    appendRecord(txn, JOURNAL_UPSERT, nextTxn, payload.data(), payload.size());
+  }
+  appendCommit(txn, nextTxn, count, records.size());
+
+  uint32_t base;
+  if (!appendTransaction(txn, base)) {
+    return false;
+  }
+
+  spans.resize(count);
+  for (size_t i = 0; i < records.size(); i++) {
+    if (records[i].first < (int)count) {
+      spans[records[i].first].offset = base + located[i].offset;
+      spans[records[i].first].length = located[i].length;
+    }
+  }
+  Serial.printf("Preset journal: %d record(s) updated, log %d bytes\n", (int)records.size(), (int)fileSize);
+
+  if (fileSize >= PRESET_JOURNAL_COMPACT_BYTES) {
+    return compact();
+  }
+  return true;
+}
+
+bool PresetJournal::compact() {
+  // Every committed record is already on disk - carry them all over
+  std::vector<PresetSummary> summaries(spans.size());
+  for (size_t i = 0; i < summaries.size(); i++) {
+    summaries[i].stored = i;
+  }
+  return writeSnapshot(summaries, std::vector<const Preset*>(), true);
+}
+
+size_t PresetJournal::getRecordLength(int slot) const {
+  return slot >= 0 && slot < (int)spans.size() ? spans[slot].length : 0;
+}
+
+size_t PresetJournal::getLiveBytes() const {
+  // One snapshot record holding every preset, plus its commit record
+  size_t bytes = 2 * (JOURNAL_RECORD_HEADER_SIZE + JOURNAL_RECORD_TRAILER_SIZE) + PRESET_TABLE_HEADER_SIZE + 4;
+  for (const PresetRecordSpan& span : spans) {
+    bytes += span.length;
+  }
+  return bytes;
+}
+
+// ====== READING ======
+
+bool PresetJournal::loadRecord(int slot, Preset& preset) {
+  if (!begin() || slot < 0 || slot >= (int)spans.size()) {
+    return false;
+  }
+
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    Serial.println("ERROR: Failed to open preset journal");
+    return false;
+  }
+  std::vector<uint8_t> record;
+  bool ok = readSpan(file, spans[slot], record);
+  file.close();
+
+  const uint8_t* p = record.data();
+  if (!ok || !PresetCodec::decodeRecord(p, p + record.size(), preset)) {
+    Serial.printf("ERROR: Stored preset %d unreadable\n", slot);
+    return false;
+  }
+  return true;
+}
+
+// ====== RECOVERY ======
+
+bool PresetJournal::recover(std::vector<PresetSummary>& summaries) {
+  if (!begin() || !LittleFS.exists(path)) {
+    return false;
+  }
+
+  unsigned long start = micros();
+
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    Serial.println("ERROR: Failed to open preset journal");
+    return false;
+  }
+  size_t size = file.size();
+
+  // Operations of the open transaction are held back until its commit
+  std::vector<PresetSummary> committed;
+  std::vector<PresetRecordSpan> committedSpans;
+  std::vector<PresetSummary> snapshot;
+  std::vector<PresetRecordSpan> snapshotSpans;
+  bool hasSnapshot = false;
+  std::vector<std::pair<uint16_t, PresetSummary>> upserts;
+  std::vector<PresetRecordSpan> upsertSpans;
+  uint32_t pendingTxn = 0;
+  uint16_t pendingOps = 0;
+
+  bool haveCommit = false;
+  uint32_t lastTxn = 0;
+  uint32_t txns = 0;
+  size_t pos = 0;
+  size_t validEnd = 0;
+
+  uint8_t header[JOURNAL_RECORD_HEADER_SIZE];
+  std::vector<uint8_t> payload;
+
+  while (size - pos >= JOURNAL_RECORD_HEADER_SIZE + JOURNAL_RECORD_TRAILER_SIZE) {
+    if (file.read(header, sizeof(header)) != sizeof(header) ||
+        PresetCodec::getU16(header) != JOURNAL_RECORD_MAGIC) {
+      break;
+    }
+    uint8_t type = header[2];
+    uint32_t txn = PresetCodec::getU32(header + 4);
+    uint32_t length = PresetCodec::getU32(header + 8);
+    if (length > PRESET_TABLE_MAX_BYTES ||
+        size - pos - JOURNAL_RECORD_HEADER_SIZE - JOURNAL_RECORD_TRAILER_SIZE < length) {
+      break;  // Torn write
+    }
+
+    payload.resize(length + JOURNAL_RECORD_TRAILER_SIZE);
+    if (file.read(payload.data(), payload.size()) != payload.size()) {
+      break;
+    }
+    uint32_t crc = PresetCodec::crc32(header, sizeof(header));
+    crc = PresetCodec::crc32(payload.data(), length, crc);
+    if (crc != PresetCodec::getU32(payload.data() + length)) {
+      break;
+    }
+    uint32_t payloadAt = pos + JOURNAL_RECORD_HEADER_SIZE;
+    pos += JOURNAL_RECORD_HEADER_SIZE + payload.size();
+
+    // A new transaction id abandons an uncommitted predecessor
+    if (txn != pendingTxn) {
+      pendingTxn = txn;
+      pendingOps = 0;
+      hasSnapshot = false;
+      upserts.clear();
+      upsertSpans.clear();
+    }
+
+    bool valid = true;
+    const uint8_t* p = payload.data();
+    if (type == JOURNAL_SNAPSHOT) {
+      valid = PresetCodec::decodeSummaries(p, length, snapshot, snapshotSpans);
+      for (PresetRecordSpan& span : snapshotSpans) {
+        span.offset += payloadAt;
+      }
+      hasSnapshot = valid;
+      upserts.clear();
+      upsertSpans.clear();
+      pendingOps++;
+    } else if (type == JOURNAL_UPSERT && length >= 2) {
+      PresetSummary summary;
+      const uint8_t* record = p + 2;
+      valid = PresetCodec::decodeSummary(record, p + length, summary);
+      upserts.push_back(std::make_pair(PresetCodec::getU16(p), summary));
+      upsertSpans.push_back({payloadAt + 2, (uint16_t)(length - 2)});
+      pendingOps++;
+    } else if (type == JOURNAL_COMMIT && length >= 4) {
+      uint16_t count = PresetCodec::getU16(p);
+      valid = (PresetCodec::getU16(p + 2) == pendingOps);
+      if (valid) {
+        if (hasSnapshot) {
+          committed.swap(snapshot);
+          committedSpans.swap(snapshotSpans);
+        }
+        for (size_t i = 0; i < upserts.size(); i++) {
+          uint16_t index = upserts[i].first;
+          if (index >= committed.size()) {
+            committed.resize(index + 1);
+            committedSpans.resize(index + 1);
+          }
+          committed[index] = upserts[i].second;
+          committedSpans[index] = upsertSpans[i];
+        }
+        committed.resize(count);
+        committedSpans.resize(count);
+
+        hasSnapshot = false;
+        upserts.clear();
+        upsertSpans.clear();
+        pendingOps = 0;
+        haveCommit = true;
+        lastTxn = txn;
+        txns++;
+        validEnd = pos;
+      }
+    } else {
+      valid = false;
+    }
+
+    if (!valid) {
+      break;
+    }
+  }
+  file.close();
+
+  stats.recoveredTxns = txns;
+  stats.discardedBytes = size - validEnd;
+  stats.lastRecoveryUs = micros() - start;
+
+  if (!haveCommit) {
+    // Nothing in it was ever acknowledged (e.g. torn first save); drop it
+    // so the next save starts a fresh log instead of appending after garbage
+    Serial.println("ERROR: Preset journal has no committed transaction, discarding it");
+    remove();
+    return false;
+  }
+
+  for (size_t i = 0; i < committed.size(); i++) {
+    committed[i].stored = i;
+  }
+  summaries.swap(committed);
+  spans.swap(committedSpans);
+  nextTxn = lastTxn + 1;
+  fileSize = size;
+
+  Serial.printf("Preset journal recovered: %d presets from %lu txn(s) in %lu us\n",
+                (int)summaries.size(), (unsigned long)txns, stats.lastRecoveryUs);
+
+  // Rewrite without the torn tail so later appends follow a valid record
+  if (stats.discardedBytes > 0) {
+    Serial.printf("Preset journal: dropping %lu byte(s) of uncommitted tail\n",
+                  (unsigned long)stats.discardedBytes);
+    tailDirty = true;  // Cleared by the rewrite; if it fails, the next commit retries it
+    compact();
+  }
+  return true;
+}
+
+void PresetJournal::printStats() const {
+  Serial.printf("Preset journal: %d bytes, %d slots, next txn %lu, %lu commit(s), %lu compaction(s)\n",
+                (int)fileSize, (int)spans.size(), (unsigned long)nextTxn, (unsigned long)stats.commits,
+                (unsigned long)stats.compactions);
+  Serial.printf("Last recovery: %lu txn(s), %lu byte(s) discarded, %lu us\n",
+                (unsigned long)stats.recoveredTxns, (unsigned long)stats.discardedBytes,
+                stats.lastRecoveryUs);
+}
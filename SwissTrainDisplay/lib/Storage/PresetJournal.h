@@ -0,0 +1,109 @@
+#ifndef PRESETJOURNAL_H
+#define PRESETJOURNAL_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <vector>
+#include "../../include/Config.h"
+#include "../../include/Types.h"
+#include "PresetCodec.h"
+
+// ====== PRESET JOURNAL FORMAT ======
+// Append-only log on LittleFS. Every save is one transaction: a run of
+// operation records followed by a commit record, written with one append.
+//
+//   record   u16 magic ("SJ")  u8 type  u8 reserved  u32 txn  u32 length
+//            payload[length]   u32 crc32(header + payload)
+//
+//   SNAPSHOT payload = PresetCodec table blob (replaces everything)
+//   UPSERT   payload = u16 index, one PresetCodec record
+//   COMMIT   payload = u16 presetCount, u16 opCount
+//
+// Recovery replays records up to the last commit whose op count matches.
+// It keeps only the index (PresetSummary) and where each preset's latest
+// record lives; full presets are read back one at a time on demand.
+// A torn or corrupt tail is dropped and the log rewritten as one snapshot.
+// Compaction writes a snapshot to <path>.tmp and renames it over the log,
+// so the old log stays valid until the rename lands. No table larger than
+// PRESET_TABLE_MAX_BYTES is written, since recovery rejects longer records.
+
+#define JOURNAL_RECORD_MAGIC 0x4A53
+#define JOURNAL_RECORD_HEADER_SIZE 12
+#define JOURNAL_RECORD_TRAILER_SIZE 4
+
+enum JournalRecordType {
+  JOURNAL_SNAPSHOT = 1,
+  JOURNAL_UPSERT = 2,
+  JOURNAL_COMMIT = 3
+};
+
+struct JournalStats {
+  uint32_t commits;          // Transactions appended since boot
+  uint32_t compactions;
+  uint32_t bytesWritten;     // Appends and compaction rewrites since boot
+  uint32_t recoveredTxns;    // Committed transactions replayed at the last recovery
+  uint32_t discardedBytes;   // Torn/uncommitted tail dropped at the last recovery
+  unsigned long lastRecoveryUs;
+
+  JournalStats() : commits(0), compactions(0), bytesWritten(0), recoveredTxns(0), discardedBytes(0), lastRecoveryUs(0) {}
+};
+
+class PresetJournal {
+private:
+  String path;
+  String tmpPath;
+  bool mounted;
+  uint32_t nextTxn;
+  size_t fileSize;
+  bool tailDirty;  // Bytes past the last commit could not be removed; next commit rewrites the log
+  std::vector<PresetRecordSpan> spans;  // Latest record of each preset slot
+  JournalStats stats;
+
+  static void appendRecord(std::vector<uint8_t>& out, uint8_t type, uint32_t txn,
+                           const uint8_t* payload, size_t length);
+  static void appendCommit(std::vector<uint8_t>& out, uint32_t txn, uint16_t count, uint16_t ops);
+  void appendSnapshot(std::vector<uint8_t>& out, const std::vector<uint8_t>& records,
+                      std::vector<PresetRecordSpan>& located);
+
+  bool readSpan(File& file, const PresetRecordSpan& span, std::vector<uint8_t>& out);
+  bool appendTransaction(const std::vector<uint8_t>& records, uint32_t& base);
+  static bool fitsTable(size_t tableBytes);
+  bool writeSnapshot(const std::vector<PresetSummary>& summaries, const std::vector<const Preset*>& hydrated,
+                     bool replace);
+
+public:
+  PresetJournal(const char* filePath = PRESET_JOURNAL_PATH);
+
+  // Mount the filesystem and drop a half-written compaction
+  bool begin();
+
+  bool exists();
+
+  // Rebuild the index of the last committed table; false if there is no usable log
+  bool recover(std::vector<PresetSummary>& summaries);
+
+  // Read the full preset stored in slot (PresetSummary::stored)
+  bool loadRecord(int slot, Preset& preset);
+
+  // Full rewrite (presets added, removed or reordered). Presets without a
+  // hydrated copy are carried over byte-for-byte from their stored slot.
+  bool commitSnapshot(const std::vector<PresetSummary>& summaries, const std::vector<const Preset*>& hydrated);
+  bool commitSnapshot(const std::vector<Preset>& presets);
+
+  // Rewrite only the given (index, preset) records; count is the new table size
+  bool commitUpdates(const std::vector<std::pair<int, const Preset*>>& records, uint16_t count);
+
+  // Rewrite the committed table as one snapshot, dropping superseded records
+  bool compact();
+
+  bool remove();
+
+  const JournalStats& getStats() const { return stats; }
+  size_t getFileSize() const { return fileSize; }
+  size_t getLiveBytes() const;  // Size the log would have right after compact()
+  int getSlotCount() const { return spans.size(); }
+  size_t getRecordLength(int slot) const;
+  void printStats() const;
+};
+
+#endif // PRESETJOURNAL_H
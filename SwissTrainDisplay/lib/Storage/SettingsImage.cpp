@@ -0,0 +1,237 @@
+#include "SettingsImage.h"
+#include "SettingsManager.h"
+
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// ====== BASE64 ======
+
+size_t SettingsImage::base64Encode(const uint8_t* data, size_t length, char* out) {
+  size_t o = 0;
+  for (size_t i = 0; i < length; i += 3) {
+    uint32_t v = (uint32_t)data[i] << 16;
+    if (i + 1 < length) v |= (uint32_t)data[i + 1] << 8;
+    if (i + 2 < length) v |= data[i + 2];
+
+    out[o++] = BASE64_CHARS[(v >> 18) & 0x3F];
+    out[o++] = BASE64_CHARS[(v >> 12) & 0x3F];
+    out[o++] = (i + 1 < length) ? BASE64_CHARS[(v >> 6) & 0x3F] : '=';
+    out[o++] = (i + 2 < length) ? BASE64_CHARS[v & 0x3F] : '=';
+  }
+  out[o] = '\0';
+  return o;
+}
+
+static int base64Value(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;
+}
+
+int SettingsImage::base64Decode(const char* in, size_t length, uint8_t* out) {
+  if (length % 4 != 0) {
+    return -1;
+  }
+
+  int o = 0;
+  for (size_t i = 0; i < length; i += 4) {
+    int a = base64Value(in[i]);
+    int b = base64Value(in[i + 1]);
+    int c = (in[i + 2] == '=') ? 0 : base64Value(in[i + 2]);
+    int d = (in[i + 3] == '=') ? 0 : base64Value(in[i + 3]);
+    if (a < 0 || b < 0 || c < 0 || d < 0) {
+      return -1;
+    }
+
+    uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | d;
+    out[o++] = v >> 16;
+    if (in[i + 2] != '=') out[o++] = (v >> 8) & 0xFF;
+    if (in[i + 3] != '=') out[o++] = v & 0xFF;
+  }
+  return o;
+}
+
+// ====== EXPORT ======
+
+void SettingsImage::encode(const std::vector<Preset>& presets, int currentPreset,
+                           const String* ssid, const String* password, std::vector<uint8_t>& out) {
+  out.clear();
+  PresetCodec::putU32(out, SETTINGS_IMAGE_MAGIC);
+  PresetCodec::putU8(out, SETTINGS_IMAGE_VERSION);
+  PresetCodec::putU8(out, ssid ? SETTINGS_IMAGE_FLAG_WIFI : 0);
+  PresetCodec::putU16(out, currentPreset);
+  PresetCodec::putString(out, ssid ? *ssid : String(""));
+  PresetCodec::putString(out, password ? *password : String(""));
+
+  std::vector<uint8_t> table;
+  PresetCodec::encode(presets, table);
+  out.insert(out.end(), table.begin(), table.end());
+}
+
+void SettingsImage::write(const std::vector<uint8_t>& body, Print& out) {
+  char line[SETTINGS_IMAGE_CHUNK_BYTES * 4 / 3 + 8];
+
+  out.printf("STDIMG %d %u %08lx\n", SETTINGS_IMAGE_VERSION, (unsigned int)body.size(),
+             (unsigned long)PresetCodec::crc32(body.data(), body.size()));
+  for (size_t i = 0; i < body.size(); i += SETTINGS_IMAGE_CHUNK_BYTES) {
+    size_t n = min((size_t)SETTINGS_IMAGE_CHUNK_BYTES, body.size() - i);
+    base64Encode(body.data() + i, n, line);
+    out.print("D ");
+    out.println(line);
+  }
+  out.println("END");
+}
+
+bool SettingsImage::exportStored(SettingsManager& settings, int currentPreset, bool includeWiFi, Print& out) {
+  // After a flush, journal slots are in preset order
+  std::vector<Preset> presets;
+  int count = settings.getPresetJournal().getSlotCount();
+  for (int i = 0; i < count; i++) {
+    Preset preset;
+    if (!settings.loadPresetRecord(i, preset)) {
+      Serial.printf("ERROR: Cannot export preset %d\n", i);
+      return false;
+    }
+    presets.push_back(preset);
+  }
+
+  String ssid, password;
+  bool wifi = includeWiFi && settings.loadWiFiCredentials(ssid, password);
+
+  std::vector<uint8_t> body;
+  encode(presets, currentPreset, wifi ? &ssid : nullptr, wifi ? &password : nullptr, body);
+  write(body, out);
+  return true;
+}
+
+// ====== IMPORT ======
+
+SettingsImageReader::SettingsImageReader()
+  : state(READER_HEADER), expectedBytes(0), expectedCrc(0), currentPreset(0), hasWiFi(false) {
+}
+
+void SettingsImageReader::begin() {
+  state = READER_HEADER;
+  expectedBytes = 0;
+  expectedCrc = 0;
+  body.clear();
+  error = "";
+  presets.clear();
+  currentPreset = 0;
+  hasWiFi = false;
+  ssid = "";
+  password = "";
+}
+
+bool SettingsImageReader::fail(const String& message) {
+  error = message;
+  state = READER_FAILED;
+  body.clear();
+  return false;
+}
+
+bool SettingsImageReader::feed(const String& line) {
+  switch (state) {
+    case READER_HEADER: {
+      unsigned int version = 0;
+      unsigned int bytes = 0;
+      unsigned long crc = 0;
+      if (sscanf(line.c_str(), "STDIMG %u %u %lx", &version, &bytes, &crc) != 3) {
+        return fail("Expected STDIMG header");
+      }
+      if (version != SETTINGS_IMAGE_VERSION) {
+        return fail("Unsupported image version " + String(version));
+      }
+      if (bytes == 0 || bytes > SETTINGS_IMAGE_MAX_BYTES) {
+        return fail("Image size out of range");
+      }
+      expectedBytes = bytes;
+      expectedCrc = crc;
+      body.reserve(bytes);
+      state = READER_DATA;
+      return true;
+    }
+
+    case READER_DATA: {
+      if (line == "END") {
+        if (body.size() != expectedBytes) {
+          return fail("Image truncated: " + String((int)body.size()) + "/" + String(expectedBytes) + " bytes");
+        }
+        if (PresetCodec::crc32(body.data(), body.size()) != expectedCrc) {
+          return fail("Image CRC mismatch");
+        }
+        if (!parseBody()) {
+          return false;
+        }
+        state = READER_DONE;
+        return false;
+      }
+
+      if (!line.startsWith("D ")) {
+        return fail("Unexpected line in image");
+      }
+      uint8_t chunk[SETTINGS_IMAGE_CHUNK_BYTES + 3];
+      size_t encoded = line.length() - 2;
+      if (encoded > (sizeof(chunk) / 3) * 4) {
+        return fail("Image line too long");
+      }
+      int n = SettingsImage::base64Decode(line.c_str() + 2, encoded, chunk);
+      if (n < 0) {
+        return fail("Bad base64 in image");
+      }
+      if (body.size() + n > expectedBytes) {
+        return fail("Image longer than its header says");
+      }
+      body.insert(body.end(), chunk, chunk + n);
+      return true;
+    }
+
+    default:
+      return false;
+  }
+}
+
+bool SettingsImageReader::parseBody() {
+  const uint8_t* p = body.data();
+  const uint8_t* end = p + body.size();
+
+  if (end - p < 8 || PresetCodec::getU32(p) != SETTINGS_IMAGE_MAGIC || p[4] != SETTINGS_IMAGE_VERSION) {
+    return fail("Not a settings image");
+  }
+  hasWiFi = (p[5] & SETTINGS_IMAGE_FLAG_WIFI) != 0;
+  currentPreset = PresetCodec::getU16(p + 6);
+  p += 8;
+
+  if (!PresetCodec::getString(p, end, ssid) || !PresetCodec::getString(p, end, password)) {
+    return fail("Image WiFi section malformed");
+  }
+
+  if (!PresetCodec::decode(p, end - p, presets)) {
+    return fail("Image preset table invalid");
+  }
+  if (presets.empty()) {
+    return fail("Image has no presets");
+  }
+  if (currentPreset >= (int)presets.size()) {
+    currentPreset = 0;
+  }
+  return true;
+}
+
+bool SettingsImageReader::apply(SettingsManager& settings) {
+  if (state != READER_DONE) {
+    return false;
+  }
+
+  if (!settings.savePresetTable(presets) || !settings.saveCurrentPreset(currentPreset)) {
+    error = "Failed to store presets";
+    return false;
+  }
+  if (hasWiFi && ssid.length() > 0 && !settings.saveWiFiCredentials(ssid, password)) {
+    error = "Failed to store WiFi credentials";
+    return false;
+  }
+  return true;
+}
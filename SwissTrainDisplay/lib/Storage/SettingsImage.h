@@ -0,0 +1,94 @@
+#ifndef SETTINGSIMAGE_H
+#define SETTINGSIMAGE_H
+
+#include <Arduino.h>
+#include <vector>
+#include "../../include/Config.h"
+#include "../../include/Types.h"
+#include "PresetCodec.h"
+
+class SettingsManager;
+
+// ====== SETTINGS IMAGE FORMAT ======
+// Provisioning image for copying presets and WiFi between units over the
+// serial console. Text framing around a binary body:
+//
+//   STDIMG <version> <bodyBytes> <crc32 hex>
+//   D <base64, SETTINGS_IMAGE_CHUNK_BYTES per line>
+//   ...
+//   END
+//
+// Body, little-endian:
+//   u32 magic ("STDI")  u8 version  u8 flags (bit0 = WiFi present)
+//   u16 currentPreset   u8 ssidLen ssid[]  u8 passLen pass[]
+//   preset table (PresetCodec format, with its own header and CRC)
+//
+// tools/settings_image.py reads and writes the same format.
+
+#define SETTINGS_IMAGE_FLAG_WIFI 0x01
+#define SETTINGS_IMAGE_MAX_BYTES (PRESET_TABLE_MAX_BYTES + 1024)
+
+class SettingsImage {
+public:
+  // Encode presets (+ optional WiFi) into a body
+  static void encode(const std::vector<Preset>& presets, int currentPreset,
+                     const String* ssid, const String* password, std::vector<uint8_t>& out);
+
+  // Frame a body as image lines
+  static void write(const std::vector<uint8_t>& body, Print& out);
+
+  // Export what is stored: presets from the journal, WiFi from Preferences.
+  // Flush PresetManager first so pending edits are included.
+  static bool exportStored(SettingsManager& settings, int currentPreset, bool includeWiFi, Print& out);
+
+  static size_t base64Encode(const uint8_t* data, size_t length, char* out);
+  static int base64Decode(const char* in, size_t length, uint8_t* out);
+};
+
+// Line-by-line import; nothing is stored until the whole image checked out
+class SettingsImageReader {
+private:
+  enum ReaderState {
+    READER_HEADER,
+    READER_DATA,
+    READER_DONE,
+    READER_FAILED
+  };
+
+  ReaderState state;
+  uint32_t expectedBytes;
+  uint32_t expectedCrc;
+  std::vector<uint8_t> body;
+  String error;
+
+  // Parsed body
+  std::vector<Preset> presets;
+  int currentPreset;
+  bool hasWiFi;
+  String ssid;
+  String password;
+
+  bool fail(const String& message);
+  bool parseBody();
+
+public:
+  SettingsImageReader();
+
+  void begin();
+
+  // Feed one line; returns true while more lines are expected
+  bool feed(const String& line);
+
+  bool succeeded() const { return state == READER_DONE; }
+  const String& getError() const { return error; }
+  size_t getBodySize() const { return body.size(); }
+
+  const std::vector<Preset>& getPresets() const { return presets; }
+  int getCurrentPreset() const { return currentPreset; }
+  bool includesWiFi() const { return hasWiFi; }
+
+  // Store presets, current index and WiFi credentials
+  bool apply(SettingsManager& settings);
+};
+
+#endif // SETTINGSIMAGE_H
@@ -1,6 +1,11 @@
 #include "SettingsManager.h"
 
-SettingsManager::SettingsManager() : initialized(false) {
+// Keys written per preset by the legacy layout: preset_<N><suffix>
+static const char* const LEGACY_PRESET_SUFFIXES[] = {"_name", "_type", "_from", "_to", "_enabled", "_trains"};
+
+SettingsManager::SettingsManager()
+  : initialized(false), indexSlotsScanned(false), indexSlot(PRESET_INDEX_SLOTS - 1), indexSeq(0),
+    legacyIndexPresent(false), usedAfterCompaction(0), compactions(0), writesAtSave(0), wearSavedAt(0) {
 }
 
 SettingsManager::~SettingsManager() {
@@ -17,8 +22,11 @@ bool SettingsManager::begin() {
   initialized = prefs.begin(PREFS_NAMESPACE, false);
   if (!initialized) {
     Serial.println("ERROR: Failed to initialize Preferences");
+    return false;
   }
-  return initialized;
+
+  loadWearTotals();
+  return true;
 }
 
 void SettingsManager::end() {
@@ -38,6 +46,7 @@ bool SettingsManager::saveWiFiCredentials(const String& ssid, const String& pass
   bool success = true;
   success &= prefs.putString(PREFS_KEY_SSID, ssid) > 0;
   success &= prefs.putString(PREFS_KEY_PASSWORD, password) > 0;
+  noteWrite(STORAGE_CLASS_WIFI, ssid.length() + password.length(), 2);
 
   if (success) {
     Serial.println("WiFi credentials saved");
@@ -68,11 +77,139 @@ bool SettingsManager::clearWiFiCredentials() {
   bool success = true;
   success &= prefs.remove(PREFS_KEY_SSID);
   success &= prefs.remove(PREFS_KEY_PASSWORD);
+  prefs.remove(PREFS_KEY_WIFI_FAST);  // May not exist
 
   return success;
 }
 
-// ====== PRESET MANAGEMENT ======
+bool SettingsManager::saveWiFiFastConnect(const WiFiFastConnect& data) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  // Skip the flash write when nothing changed (the common reconnect case)
+  WiFiFastConnect stored;
+  if (loadWiFiFastConnect(stored) && stored == data) {
+    return true;
+  }
+
+  bool success = prefs.putBytes(PREFS_KEY_WIFI_FAST, &data, sizeof(data)) == sizeof(data);
+  noteWrite(STORAGE_CLASS_WIFI_FAST, sizeof(data));
+  if (!success) {
+    Serial.println("ERROR: Failed to save WiFi fast-connect data");
+  }
+  return success;
+}
+
+bool SettingsManager::loadWiFiFastConnect(WiFiFastConnect& data) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  if (prefs.getBytesLength(PREFS_KEY_WIFI_FAST) != sizeof(data)) {
+    return false;  // Missing or from an older layout
+  }
+  return prefs.getBytes(PREFS_KEY_WIFI_FAST, &data, sizeof(data)) == sizeof(data);
+}
+
+bool SettingsManager::clearWiFiFastConnect() {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  return prefs.remove(PREFS_KEY_WIFI_FAST);
+}
+
+// ====== PRESET TABLE ======
+
+bool SettingsManager::savePresetTable(const std::vector<Preset>& presets) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  if (!journal.commitSnapshot(presets)) {
+    Serial.println("ERROR: Failed to save preset table");
+    return false;
+  }
+  return true;
+}
+
+bool SettingsManager::savePresetTable(const std::vector<PresetSummary>& summaries,
+                                      const std::vector<const Preset*>& hydrated) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  if (!journal.commitSnapshot(summaries, hydrated)) {
+    Serial.println("ERROR: Failed to save preset table");
+    return false;
+  }
+  return true;
+}
+
+bool SettingsManager::savePresetRecords(const std::vector<std::pair<int, const Preset*>>& records, int count) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  if (!journal.commitUpdates(records, count)) {
+    Serial.println("ERROR: Failed to save preset records");
+    return false;
+  }
+  return true;
+}
+
+bool SettingsManager::loadPresetIndex(std::vector<PresetSummary>& summaries) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  if (journal.recover(summaries)) {
+    return true;
+  }
+
+  // Older firmware kept the table as one Preferences blob
+  size_t length = prefs.getBytesLength(PREFS_KEY_PRESET_TABLE);
+  if (length == 0 || length > PRESET_TABLE_MAX_BYTES) {
+    return false;
+  }
+
+  std::vector<uint8_t> blob(length);
+  if (prefs.getBytes(PREFS_KEY_PRESET_TABLE, blob.data(), length) != length) {
+    Serial.println("ERROR: Failed to read preset table");
+    return false;
+  }
+  std::vector<Preset> presets;
+  if (!PresetCodec::decode(blob.data(), length, presets)) {
+    return false;
+  }
+
+  // Move it into the journal; drop the blob only once that committed
+  Serial.println("Moving preset table into the journal");
+  if (!journal.commitSnapshot(presets) || !journal.recover(summaries)) {
+    return false;
+  }
+  prefs.remove(PREFS_KEY_PRESET_TABLE);
+  return true;
+}
+
+bool SettingsManager::loadPresetRecord(int slot, Preset& preset) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  return journal.loadRecord(slot, preset);
+}
+
+bool SettingsManager::hasPresetTable() {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  return journal.exists() || prefs.isKey(PREFS_KEY_PRESET_TABLE);
+}
+
+// ====== LEGACY PRESET KEYS ======
 
 bool SettingsManager::savePreset(int index, const Preset& preset) {
   if (!initialized && !begin()) {
@@ -94,6 +231,8 @@ bool SettingsManager::savePreset(int index, const Preset& preset) {
   success &= prefs.putString(keyTo.c_str(), preset.toStation) > 0;
   success &= prefs.putBool(keyEnabled.c_str(), preset.enabled);
   success &= prefs.putUChar(keyTrainsCount.c_str(), preset.trainsToDisplay) > 0;
+  noteWrite(STORAGE_CLASS_LEGACY,
+            preset.name.length() + preset.fromStation.length() + preset.toStation.length() + 6, 6);
 
   if (success) {
     Serial.printf("Preset %d saved: %s\n", index, preset.name.c_str());
@@ -137,24 +276,58 @@ bool SettingsManager::deletePreset(int index) {
     return false;
   }
 
-  // Create keys for this preset
-  String keyName = String(PREFS_KEY_PRESET_PREFIX) + String(index) + "_name";
-  String keyType = String(PREFS_KEY_PRESET_PREFIX) + String(index) + "_type";
-  String keyFrom = String(PREFS_KEY_PRESET_PREFIX) + String(index) + "_from";
-  String keyTo = String(PREFS_KEY_PRESET_PREFIX) + String(index) + "_to";
-  String keyEnabled = String(PREFS_KEY_PRESET_PREFIX) + String(index) + "_enabled";
-
+  // Every key savePreset() writes, including _trains
+  String prefix = String(PREFS_KEY_PRESET_PREFIX) + String(index);
   bool success = true;
-  success &= prefs.remove(keyName.c_str());
-  success &= prefs.remove(keyType.c_str());
-  success &= prefs.remove(keyFrom.c_str());
-  success &= prefs.remove(keyTo.c_str());
-  success &= prefs.remove(keyEnabled.c_str());
+  for (const char* suffix : LEGACY_PRESET_SUFFIXES) {
+    String key = prefix + suffix;
+    if (prefs.isKey(key.c_str())) {
+      success &= prefs.remove(key.c_str());
+    }
+  }
 
   Serial.printf("Preset %d deleted\n", index);
   return success;
 }
 
+bool SettingsManager::removeLegacyPresets(int count) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  for (int i = 0; i < count; i++) {
+    String prefix = String(PREFS_KEY_PRESET_PREFIX) + String(i);
+    for (const char* suffix : LEGACY_PRESET_SUFFIXES) {
+      prefs.remove((prefix + suffix).c_str());  // Missing keys are fine
+    }
+  }
+  prefs.remove(PREFS_KEY_PRESET_COUNT);
+
+  Serial.printf("Removed legacy keys for %d presets\n", count);
+  return true;
+}
+
+int SettingsManager::removeOrphanedLegacyKeys() {
+  // Older firmware deleted presets without renumbering and never removed
+  // _trains, so keys can sit past the stored count and in gaps. Indices
+  // below a remaining count are still unmigrated presets - leave those.
+  int removed = 0;
+  int gap = 0;
+  for (int i = getPresetCount(); gap < LEGACY_KEY_SCAN_GAP; i++) {
+    String prefix = String(PREFS_KEY_PRESET_PREFIX) + String(i);
+    bool found = false;
+    for (const char* suffix : LEGACY_PRESET_SUFFIXES) {
+      String key = prefix + suffix;
+      if (prefs.isKey(key.c_str()) && prefs.remove(key.c_str())) {
+        removed++;
+        found = true;
+      }
+    }
+    gap = found ? 0 : gap + 1;
+  }
+  return removed;
+}
+
 int SettingsManager::getPresetCount() {
   if (!initialized && !begin()) {
     return 0;
@@ -168,17 +341,79 @@ bool SettingsManager::setPresetCount(int count) {
     return false;
   }
 
+  noteWrite(STORAGE_CLASS_LEGACY, sizeof(int32_t));
   return prefs.putInt(PREFS_KEY_PRESET_COUNT, count) > 0;
 }
 
 // ====== CURRENT STATE ======
 
+String SettingsManager::indexSlotKey(int slot) {
+  return String(PREFS_KEY_CURRENT_SLOT_PREFIX) + String(slot);
+}
+
+void SettingsManager::scanIndexSlots(int& index) {
+  indexSlotsScanned = true;
+  indexSlot = PRESET_INDEX_SLOTS - 1;  // First write lands in slot 0
+  indexSeq = 0;
+  index = -1;
+
+  for (int slot = 0; slot < PRESET_INDEX_SLOTS; slot++) {
+    uint32_t value = prefs.getUInt(indexSlotKey(slot).c_str(), 0);
+    uint32_t seq = value >> 8;
+    if (seq == 0) {
+      continue;  // Never written
+    }
+
+    // Serial-number compare so the 24-bit sequence can wrap
+    if (indexSeq == 0 || (((seq - indexSeq) & 0xFFFFFF) != 0 && ((seq - indexSeq) & 0xFFFFFF) < 0x800000)) {
+      indexSeq = seq;
+      indexSlot = slot;
+      index = value & 0xFF;
+    }
+  }
+
+  if (index < 0) {
+    // Nothing rotated yet - fall back to the old single key
+    index = prefs.getInt(PREFS_KEY_CURRENT_PRESET, 0);
+    legacyIndexPresent = true;
+  }
+}
+
 bool SettingsManager::saveCurrentPreset(int index) {
   if (!initialized && !begin()) {
     return false;
   }
 
-  return prefs.putInt(PREFS_KEY_CURRENT_PRESET, index) > 0;
+  if (index < 0 || index > 0xFF) {
+    Serial.println("ERROR: Preset index out of range");
+    return false;
+  }
+
+  if (!indexSlotsScanned) {
+    int ignored;
+    scanIndexSlots(ignored);
+  }
+
+  // Write the next slot so no single key takes every update
+  uint8_t slot = (indexSlot + 1) % PRESET_INDEX_SLOTS;
+  uint32_t seq = (indexSeq + 1) & 0xFFFFFF;
+  if (seq == 0) {
+    seq = 1;  // 0 marks an empty slot
+  }
+
+  noteWrite(STORAGE_CLASS_INDEX, sizeof(uint32_t));
+  if (prefs.putUInt(indexSlotKey(slot).c_str(), (seq << 8) | (uint32_t)index) == 0) {
+    Serial.println("ERROR: Failed to save current preset");
+    return false;
+  }
+  indexSlot = slot;
+  indexSeq = seq;
+
+  if (legacyIndexPresent) {
+    prefs.remove(PREFS_KEY_CURRENT_PRESET);
+    legacyIndexPresent = false;
+  }
+  return true;
 }
 
 int SettingsManager::loadCurrentPreset() {
@@ -186,7 +421,202 @@ int SettingsManager::loadCurrentPreset() {
     return 0;
   }
 
-  return prefs.getInt(PREFS_KEY_CURRENT_PRESET, 0);
+  int index;
+  scanIndexSlots(index);
+  return index;
+}
+
+// ====== COMPACTION ======
+
+bool SettingsManager::getStorageSpace(size_t& used, size_t& total) {
+  FSInfo info;
+  if (!journal.begin() || !LittleFS.info(info)) {
+    return false;
+  }
+  used = info.usedBytes;
+  total = info.totalBytes;
+  return true;
+}
+
+bool SettingsManager::compactStorage(StorageCompactReport& report) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  unsigned long start = millis();
+  report = StorageCompactReport();
+  getStorageSpace(report.usedBefore, report.totalBytes);
+
+  // Superseded journal records; skipped when the log is already one snapshot
+  bool success = true;
+  report.journalBefore = journal.getFileSize();
+  if (journal.getSlotCount() > 0 && journal.getFileSize() > journal.getLiveBytes()) {
+    success = journal.compact();
+  }
+  report.journalAfter = journal.getFileSize();
+
+  report.legacyKeysRemoved = removeOrphanedLegacyKeys();
+
+  getStorageSpace(report.usedAfter, report.totalBytes);
+  report.elapsedMs = millis() - start;
+  usedAfterCompaction = report.usedAfter;
+  compactions++;
+
+  Serial.printf("Storage compacted: journal %d -> %d bytes, %d legacy key(s) removed, "
+                "%ld bytes reclaimed, %d/%d bytes free (%lu ms)\n",
+                (int)report.journalBefore, (int)report.journalAfter, report.legacyKeysRemoved,
+                report.reclaimedBytes(), (int)report.freeBytes(), (int)report.totalBytes, report.elapsedMs);
+  if (!success) {
+    Serial.println("ERROR: Preset journal compaction failed");
+  }
+  return success;
+}
+
+bool SettingsManager::compactIfLow() {
+  size_t used, total;
+  if (!getStorageSpace(used, total) || total - used >= STORAGE_COMPACT_FREE_BYTES) {
+    return false;
+  }
+  if (usedAfterCompaction != 0 && used <= usedAfterCompaction) {
+    return false;  // Nothing written since the last pass could have freed more
+  }
+
+  Serial.printf("Storage low: %d bytes free, compacting\n", (int)(total - used));
+  StorageCompactReport report;
+  compactStorage(report);
+  return true;
+}
+
+// ====== TELEMETRY ======
+
+uint32_t StorageWriteCounts::totalWrites() const {
+  uint32_t total = 0;
+  for (int i = 0; i < STORAGE_CLASS_COUNT; i++) {
+    total += writes[i];
+  }
+  return total;
+}
+
+uint32_t StorageWriteCounts::totalBytes() const {
+  uint32_t total = 0;
+  for (int i = 0; i < STORAGE_CLASS_COUNT; i++) {
+    total += bytes[i];
+  }
+  return total;
+}
+
+void StorageWriteCounts::add(const StorageWriteCounts& other) {
+  for (int i = 0; i < STORAGE_CLASS_COUNT; i++) {
+    writes[i] += other.writes[i];
+    bytes[i] += other.bytes[i];
+  }
+}
+
+uint32_t StorageTelemetry::estimatedErases() const {
+  uint64_t written = (uint64_t)lifetime.totalBytes() + (uint64_t)lifetime.totalWrites() * STORAGE_WRITE_OVERHEAD_BYTES;
+  return (uint32_t)((written + blockSize - 1) / blockSize);
+}
+
+float StorageTelemetry::erasesPerBlock() const {
+  size_t blocks = totalBytes / blockSize;
+  return blocks > 0 ? (float)estimatedErases() / blocks : 0.0f;
+}
+
+const char* StorageTelemetry::className(int keyClass) {
+  static const char* const NAMES[STORAGE_CLASS_COUNT] = {
+    "presets", "index", "wifi", "wifiFast", "legacy", "telemetry"
+  };
+  return (keyClass >= 0 && keyClass < STORAGE_CLASS_COUNT) ? NAMES[keyClass] : "?";
+}
+
+void SettingsManager::noteWrite(StorageKeyClass keyClass, size_t bytes, int keys) {
+  bootWrites.writes[keyClass] += keys;
+  bootWrites.bytes[keyClass] += bytes;
+}
+
+void SettingsManager::collectBootWrites(StorageWriteCounts& out) const {
+  out = bootWrites;
+  const JournalStats& stats = journal.getStats();
+  out.writes[STORAGE_CLASS_PRESETS] = stats.commits;
+  out.bytes[STORAGE_CLASS_PRESETS] = stats.bytesWritten;
+}
+
+void SettingsManager::loadWearTotals() {
+  if (prefs.getBytesLength(PREFS_KEY_WEAR_STATS) != sizeof(savedTotals) ||
+      prefs.getBytes(PREFS_KEY_WEAR_STATS, &savedTotals, sizeof(savedTotals)) != sizeof(savedTotals)) {
+    savedTotals = StorageWriteCounts();  // First boot or an older layout - start over
+  }
+}
+
+bool SettingsManager::saveWearTotals(bool force) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  StorageWriteCounts boot;
+  collectBootWrites(boot);
+  if (boot.totalWrites() == writesAtSave) {
+    return true;  // Nothing new to record
+  }
+  if (!force && wearSavedAt != 0 && millis() - wearSavedAt < STORAGE_WEAR_SAVE_MS) {
+    return true;
+  }
+
+  // Count this write too, so the stored totals include it
+  noteWrite(STORAGE_CLASS_TELEMETRY, sizeof(StorageWriteCounts));
+  collectBootWrites(boot);
+  StorageWriteCounts totals = savedTotals;
+  totals.add(boot);
+
+  if (prefs.putBytes(PREFS_KEY_WEAR_STATS, &totals, sizeof(totals)) != sizeof(totals)) {
+    Serial.println("ERROR: Failed to save storage wear counters");
+    return false;
+  }
+  writesAtSave = boot.totalWrites();
+  wearSavedAt = millis();
+  return true;
+}
+
+bool SettingsManager::getTelemetry(StorageTelemetry& telemetry) {
+  if (!initialized && !begin()) {
+    return false;
+  }
+
+  collectBootWrites(telemetry.boot);
+  telemetry.lifetime = savedTotals;
+  telemetry.lifetime.add(telemetry.boot);
+  telemetry.journalBytes = journal.getFileSize();
+  telemetry.compactions = compactions;
+
+  FSInfo info;
+  if (!journal.begin() || !LittleFS.info(info)) {
+    return false;
+  }
+  telemetry.usedBytes = info.usedBytes;
+  telemetry.totalBytes = info.totalBytes;
+  telemetry.blockSize = info.blockSize > 0 ? info.blockSize : 4096;
+  return true;
+}
+
+void SettingsManager::printTelemetry() {
+  StorageTelemetry telemetry;
+  if (!getTelemetry(telemetry)) {
+    Serial.println("ERROR: Storage info unavailable");
+    return;
+  }
+
+  Serial.printf("Storage: %d/%d bytes used, %d free, %d-byte blocks, journal %d bytes, %lu compaction(s)\n",
+                (int)telemetry.usedBytes, (int)telemetry.totalBytes, (int)telemetry.freeBytes(),
+                (int)telemetry.blockSize, (int)telemetry.journalBytes, (unsigned long)telemetry.compactions);
+  Serial.println("  class        boot writes     bytes   lifetime writes      bytes");
+  for (int i = 0; i < STORAGE_CLASS_COUNT; i++) {
+    Serial.printf("  %-10s %12lu %9lu %17lu %10lu\n", StorageTelemetry::className(i),
+                  (unsigned long)telemetry.boot.writes[i], (unsigned long)telemetry.boot.bytes[i],
+                  (unsigned long)telemetry.lifetime.writes[i], (unsigned long)telemetry.lifetime.bytes[i]);
+  }
+  Serial.printf("Estimated erases: %lu total, %.2f per block (%.3f%% of %d rated)\n",
+                (unsigned long)telemetry.estimatedErases(), telemetry.erasesPerBlock(),
+                telemetry.wearPercent(), STORAGE_FLASH_ENDURANCE);
 }
 
 // ====== UTILITY ======
@@ -196,7 +626,8 @@ bool SettingsManager::clearAll() {
     return false;
   }
 
-  bool success = prefs.clear();
+  bool success = prefs.clear() && journal.remove();
+  indexSlotsScanned = false;
   Serial.println(success ? "All settings cleared" : "ERROR: Failed to clear settings");
   return success;
 }
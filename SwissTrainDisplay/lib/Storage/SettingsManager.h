@@ -3,13 +3,113 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include <vector>
 #include "../../include/Config.h"
 #include "../../include/Types.h"
+#include "PresetCodec.h"
+#include "PresetJournal.h"
+
+// ====== STORAGE TELEMETRY ======
+// Writes are counted per key class. Preset counts come from the journal;
+// the rest are Preferences keys. Lifetime totals persist in
+// PREFS_KEY_WEAR_STATS (at most every STORAGE_WEAR_SAVE_MS).
+
+enum StorageKeyClass {
+  STORAGE_CLASS_PRESETS,     // Preset journal appends and compactions
+  STORAGE_CLASS_INDEX,       // Current preset slots
+  STORAGE_CLASS_WIFI,        // SSID and password
+  STORAGE_CLASS_WIFI_FAST,   // Fast-reconnect BSSID/channel/lease
+  STORAGE_CLASS_LEGACY,      // preset_N_* keys and count
+  STORAGE_CLASS_TELEMETRY,   // The wear counters themselves
+  STORAGE_CLASS_COUNT
+};
+
+struct StorageWriteCounts {
+  uint32_t writes[STORAGE_CLASS_COUNT];
+  uint32_t bytes[STORAGE_CLASS_COUNT];
+
+  StorageWriteCounts() {
+    memset(writes, 0, sizeof(writes));
+    memset(bytes, 0, sizeof(bytes));
+  }
+
+  uint32_t totalWrites() const;
+  uint32_t totalBytes() const;
+  void add(const StorageWriteCounts& other);
+};
+
+struct StorageTelemetry {
+  StorageWriteCounts boot;      // Since power-on
+  StorageWriteCounts lifetime;  // Persisted totals plus this boot
+  size_t usedBytes;
+  size_t totalBytes;
+  size_t blockSize;
+  size_t journalBytes;
+  uint32_t compactions;
+
+  StorageTelemetry() : usedBytes(0), totalBytes(0), blockSize(4096), journalBytes(0), compactions(0) {}
+
+  size_t freeBytes() const { return totalBytes - usedBytes; }
+
+  // LittleFS spreads erases over the partition; assume each write costs
+  // its bytes plus STORAGE_WRITE_OVERHEAD_BYTES of metadata
+  uint32_t estimatedErases() const;
+  float erasesPerBlock() const;
+  float wearPercent() const { return erasesPerBlock() * 100.0f / STORAGE_FLASH_ENDURANCE; }
+
+  static const char* className(int keyClass);
+};
+
+// Outcome of one compactStorage() pass
+struct StorageCompactReport {
+  size_t journalBefore;
+  size_t journalAfter;
+  int legacyKeysRemoved;
+  size_t usedBefore;     // LittleFS bytes in use, before and after
+  size_t usedAfter;
+  size_t totalBytes;
+  unsigned long elapsedMs;
+
+  StorageCompactReport()
+    : journalBefore(0), journalAfter(0), legacyKeysRemoved(0), usedBefore(0), usedAfter(0),
+      totalBytes(0), elapsedMs(0) {}
+
+  long reclaimedBytes() const { return (long)usedBefore - (long)usedAfter; }
+  size_t freeBytes() const { return totalBytes - usedAfter; }
+};
 
 class SettingsManager {
 private:
   Preferences prefs;
   bool initialized;
+  PresetJournal journal;
+
+  // Current preset index rotates over PRESET_INDEX_SLOTS keys; each holds
+  // (sequence << 8 | index) and the highest sequence wins on load
+  bool indexSlotsScanned;
+  uint8_t indexSlot;        // Slot holding the newest value
+  uint32_t indexSeq;        // Its 24-bit sequence (0 = no slot written yet)
+  bool legacyIndexPresent;  // Old single-key value still to be removed
+
+  static String indexSlotKey(int slot);
+  void scanIndexSlots(int& index);
+
+  // Automatic compaction waits for usage to grow past the last result,
+  // so a store that is simply full does not compact on every check
+  size_t usedAfterCompaction;
+  uint32_t compactions;
+
+  int removeOrphanedLegacyKeys();
+
+  // Write telemetry - journal counts are taken from its stats
+  StorageWriteCounts bootWrites;
+  StorageWriteCounts savedTotals;   // Lifetime totals as of boot
+  uint32_t writesAtSave;            // Boot writes already included in the stored totals
+  unsigned long wearSavedAt;
+
+  void noteWrite(StorageKeyClass keyClass, size_t bytes, int keys = 1);
+  void collectBootWrites(StorageWriteCounts& out) const;
+  void loadWearTotals();
 
 public:
   SettingsManager();
@@ -24,16 +124,49 @@ public:
   bool loadWiFiCredentials(String& ssid, String& password);
   bool clearWiFiCredentials();
 
-  // Preset management
+  // WiFi fast reconnect data (BSSID, channel, lease or static IP)
+  bool saveWiFiFastConnect(const WiFiFastConnect& data);
+  bool loadWiFiFastConnect(WiFiFastConnect& data);
+  bool clearWiFiFastConnect();
+
+  // Preset table, journaled on LittleFS (see PresetJournal)
+  bool savePresetTable(const std::vector<Preset>& presets);
+  bool savePresetTable(const std::vector<PresetSummary>& summaries, const std::vector<const Preset*>& hydrated);
+  bool savePresetRecords(const std::vector<std::pair<int, const Preset*>>& records, int count);
+  bool loadPresetIndex(std::vector<PresetSummary>& summaries);
+  bool loadPresetRecord(int slot, Preset& preset);
+  bool hasPresetTable();
+  PresetJournal& getPresetJournal() { return journal; }
+
+  // Legacy per-key preset layout (preset_N_*), kept for migration
   bool savePreset(int index, const Preset& preset);
   bool loadPreset(int index, Preset& preset);
   bool deletePreset(int index);
   int getPresetCount();
   bool setPresetCount(int count);
+  bool removeLegacyPresets(int count);
 
-  // Current state
+  // Current state (wear-spread over rotating slots)
   bool saveCurrentPreset(int index);
   int loadCurrentPreset();
+  uint8_t getCurrentPresetSlot() const { return indexSlot; }
+
+  // Space on the LittleFS partition shared by Preferences and the journal
+  bool getStorageSpace(size_t& used, size_t& total);
+
+  // Rewrite the journal densely and drop orphaned legacy preset keys
+  bool compactStorage(StorageCompactReport& report);
+
+  // Compact when free space is below STORAGE_COMPACT_FREE_BYTES; true if it ran
+  bool compactIfLow();
+  uint32_t getCompactionCount() const { return compactions; }
+
+  // Usage, free space and write/wear counters
+  bool getTelemetry(StorageTelemetry& telemetry);
+  void printTelemetry();
+
+  // Persist lifetime write counters if they changed; throttled unless forced
+  bool saveWearTotals(bool force = false);
 
   // Utility
   bool clearAll();
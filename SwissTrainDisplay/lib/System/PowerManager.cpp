@@ -0,0 +1,179 @@
+#include "PowerManager.h"
+
+#ifdef ESP8266
+extern "C" {
+  #include <user_interface.h>
+  #include <gpio.h>
+}
+#endif
+
+PowerManager::PowerManager()
+  : mode(POWER_MODE_ALWAYS_ON), dozing(false), lastActivity(0),
+    wakeCheck(nullptr), wakePinCount(0), wakeArmed(false) {
+}
+
+void PowerManager::begin(PowerMode initialMode, const int pins[], int pinCount) {
+  wakePinCount = min(pinCount, MAX_WAKE_PINS);
+  for (int i = 0; i < wakePinCount; i++) {
+    wakePins[i] = pins[i];
+  }
+
+  lastActivity = millis();
+  resetStats();
+  setMode(initialMode);
+}
+
+void PowerManager::setMode(PowerMode newMode) {
+  mode = newMode;
+  if (mode == POWER_MODE_ALWAYS_ON) {
+    dozing = false;
+  }
+  disarmWakePins();
+  applyRadioMode();
+  Serial.printf("Power mode: %s\n", modeName(mode));
+}
+
+void PowerManager::applyRadioMode() {
+  // Light-sleep only while dozing; awake it would add beacon latency to input
+  if (mode == POWER_MODE_ALWAYS_ON) {
+    WiFi.setSleepMode(WIFI_NONE_SLEEP);
+  } else if (mode == POWER_MODE_LIGHT_SLEEP && dozing) {
+    WiFi.setSleepMode(WIFI_LIGHT_SLEEP, POWER_LISTEN_INTERVAL);
+  } else {
+    WiFi.setSleepMode(WIFI_MODEM_SLEEP);
+  }
+}
+
+void PowerManager::armWakePins() {
+#ifdef ESP8266
+  // Wake on the level opposite to the current one (encoder pins rest either way)
+  for (int i = 0; i < wakePinCount; i++) {
+    int level = digitalRead(wakePins[i]) == HIGH ? GPIO_PIN_INTR_LOLEVEL : GPIO_PIN_INTR_HILEVEL;
+    gpio_pin_wakeup_enable(GPIO_ID_PIN(wakePins[i]), level);
+  }
+  wakeArmed = true;
+#endif
+}
+
+void PowerManager::disarmWakePins() {
+#ifdef ESP8266
+  if (!wakeArmed) {
+    return;
+  }
+
+  // Wakeup disable also turns the pin interrupts off; restore the CHANGE
+  // (any edge) type set by attachInterrupt or the ISRs would fire
+  // continuously while the pin holds the wake level
+  gpio_pin_wakeup_disable();
+  for (int i = 0; i < wakePinCount; i++) {
+    gpio_pin_intr_state_set(GPIO_ID_PIN(wakePins[i]), GPIO_PIN_INTR_ANYEDGE);
+  }
+  wakeArmed = false;
+#endif
+}
+
+// ====== DOZE ======
+
+bool PowerManager::noteActivity() {
+  lastActivity = millis();
+  if (!dozing) {
+    return false;
+  }
+
+  dozing = false;
+  stats.wakeups++;
+  disarmWakePins();
+  applyRadioMode();
+  return true;
+}
+
+bool PowerManager::update(bool screenAllowsSleep) {
+  bool shouldDoze = mode != POWER_MODE_ALWAYS_ON && screenAllowsSleep &&
+                    millis() - lastActivity >= POWER_IDLE_TIMEOUT_MS;
+
+  if (shouldDoze == dozing) {
+    return false;
+  }
+
+  dozing = shouldDoze;
+  if (dozing) {
+    stats.dozeEntries++;
+  } else {
+    disarmWakePins();
+  }
+  applyRadioMode();
+  return true;
+}
+
+void PowerManager::idle(unsigned long maxSleepMs) {
+  if (mode == POWER_MODE_ALWAYS_ON || maxSleepMs == 0) {
+    yield();
+    return;
+  }
+
+  // Light-sleep needs one long delay to actually sleep; GPIO wakes the
+  // CPU for the ISR, the queued input is handled when the delay ends
+  bool lightSleep = dozing && mode == POWER_MODE_LIGHT_SLEEP;
+  unsigned long slice = lightSleep ? maxSleepMs : POWER_SLEEP_SLICE_MS;
+
+  unsigned long start = micros();
+  unsigned long until = millis() + maxSleepMs;
+  long remaining;
+  while ((remaining = (long)(until - millis())) > 0) {
+    if (wakeCheck && wakeCheck()) {
+      break;
+    }
+    if (lightSleep) {
+      armWakePins();  // Level wake held at most one doze poll period
+    }
+    delay(min((unsigned long)remaining, slice));
+    disarmWakePins();
+  }
+  unsigned long elapsed = micros() - start;
+  stats.idleUs += elapsed;
+  if (lightSleep) {
+    stats.lightSleepUs += elapsed;
+  }
+}
+
+// ====== STATISTICS ======
+
+static float percentOfWindow(uint64_t us, unsigned long sinceMs) {
+  unsigned long elapsedMs = millis() - sinceMs;
+  if (elapsedMs == 0) {
+    return 0.0f;
+  }
+  return min(100.0f, 100.0f * (us / 1000.0f) / elapsedMs);
+}
+
+float PowerManager::getAwakePercent() const {
+  return 100.0f - percentOfWindow(stats.lightSleepUs, stats.sinceMs);
+}
+
+float PowerManager::getIdlePercent() const {
+  return percentOfWindow(stats.idleUs, stats.sinceMs);
+}
+
+void PowerManager::printStats() const {
+  Serial.printf("Power: %s, %s, awake %.1f%% over %lu s\n",
+                modeName(mode), dozing ? "dozing" : "active",
+                getAwakePercent(), (millis() - stats.sinceMs) / 1000);
+  Serial.printf("  idle (no task running): %.1f%%, light-sleep: %lu ms\n",
+                getIdlePercent(), (unsigned long)(stats.lightSleepUs / 1000));
+  Serial.printf("  doze entries: %lu, wakeups by input: %lu\n",
+                (unsigned long)stats.dozeEntries, (unsigned long)stats.wakeups);
+}
+
+void PowerManager::resetStats() {
+  stats = PowerStats();
+  stats.sinceMs = millis();
+}
+
+const char* PowerManager::modeName(PowerMode m) {
+  switch (m) {
+    case POWER_MODE_ALWAYS_ON:   return "always-on";
+    case POWER_MODE_MODEM_SLEEP: return "modem-sleep";
+    case POWER_MODE_LIGHT_SLEEP: return "light-sleep";
+  }
+  return "?";
+}
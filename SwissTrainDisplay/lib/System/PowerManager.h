@@ -0,0 +1,83 @@
+#ifndef POWERMANAGER_H
+#define POWERMANAGER_H
+
+#include <Arduino.h>
+#ifdef ESP32
+  #include <WiFi.h>
+#elif defined(ESP8266)
+  #include <ESP8266WiFi.h>
+#endif
+#include "../../include/Config.h"
+#include "../../include/Types.h"
+
+// ====== POWER MANAGER ======
+// Sleeps the radio (and in light-sleep mode the CPU) while the scheduler
+// is idle. After POWER_IDLE_TIMEOUT_MS without input, and if the screen
+// allows it, the device "dozes": polling slows to POWER_DOZE_POLL_MS
+// and encoder/button GPIO wake it up again. Wake pins are level-triggered,
+// so they are armed only around each light-sleep delay and switched back
+// to the CHANGE interrupts the input handlers rely on right after.
+
+// Returns true when input is waiting (checked between sleep slices)
+typedef bool (*WakeCheck)();
+
+struct PowerStats {
+  uint64_t idleUs;         // Time spent in idle delay(), CPU may stay clocked
+  uint64_t lightSleepUs;   // Part of idleUs spent dozing in light-sleep (CPU stopped)
+  uint32_t dozeEntries;
+  uint32_t wakeups;        // Dozes ended by input
+  unsigned long sinceMs;   // Start of the measurement window
+
+  PowerStats() : idleUs(0), lightSleepUs(0), dozeEntries(0), wakeups(0), sinceMs(0) {}
+};
+
+#define MAX_WAKE_PINS 3
+
+class PowerManager {
+private:
+  PowerMode mode;
+  bool dozing;
+  unsigned long lastActivity;
+  WakeCheck wakeCheck;
+  PowerStats stats;
+
+  int wakePins[MAX_WAKE_PINS];
+  int wakePinCount;
+  bool wakeArmed;
+
+  void applyRadioMode();
+  void armWakePins();
+  void disarmWakePins();
+
+public:
+  PowerManager();
+
+  // Initialize with the GPIOs that should wake the CPU from light-sleep
+  void begin(PowerMode initialMode, const int pins[], int pinCount);
+
+  void setMode(PowerMode newMode);
+  PowerMode getMode() const { return mode; }
+  void setWakeCheck(WakeCheck check) { wakeCheck = check; }
+
+  // Input seen - returns true if this ended a doze
+  bool noteActivity();
+
+  // Periodic: enter doze when idle long enough. Returns true on change.
+  bool update(bool screenAllowsSleep);
+  bool isDozing() const { return dozing; }
+
+  // Scheduler idle hook: sleep up to maxSleepMs or until input arrives
+  void idle(unsigned long maxSleepMs);
+
+  // Statistics - awake % counts only light-sleep as asleep, so it tracks
+  // average CPU current; idle % is time with no task running
+  float getAwakePercent() const;
+  float getIdlePercent() const;
+  const PowerStats& getStats() const { return stats; }
+  void printStats() const;
+  void resetStats();
+
+  static const char* modeName(PowerMode m);
+};
+
+#endif // POWERMANAGER_H
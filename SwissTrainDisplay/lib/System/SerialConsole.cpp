@@ -0,0 +1,89 @@
+#include "SerialConsole.h"
+
+SerialConsole::SerialConsole()
+  : commandCount(0), lineBuffer(""), sink(nullptr), captureTimeoutMs(0), lastLineAt(0) {
+}
+
+bool SerialConsole::addCommand(const char* name, const char* help, ConsoleHandler handler) {
+  if (commandCount >= MAX_CONSOLE_COMMANDS || handler == nullptr) {
+    Serial.printf("ERROR: Cannot add console command %s\n", name);
+    return false;
+  }
+
+  ConsoleCommand& cmd = commands[commandCount++];
+  cmd.name = name;
+  cmd.help = help;
+  cmd.handler = handler;
+  return true;
+}
+
+void SerialConsole::capture(ConsoleLineSink lineSink, unsigned long timeoutMs) {
+  sink = lineSink;
+  captureTimeoutMs = timeoutMs;
+  lastLineAt = millis();
+}
+
+void SerialConsole::poll() {
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+
+    if (c == '\r') {
+      continue;
+    }
+
+    if (c == '\n') {
+      String line = lineBuffer;
+      lineBuffer = "";
+      line.trim();
+      if (line.length() == 0) {
+        continue;
+      }
+      if (sink) {
+        lastLineAt = millis();
+        if (!sink(line)) {
+          sink = nullptr;
+        }
+      } else {
+        execute(line);
+      }
+      continue;
+    }
+
+    if (lineBuffer.length() < CONSOLE_MAX_LINE) {
+      lineBuffer += c;
+    }
+  }
+
+  if (sink && millis() - lastLineAt > captureTimeoutMs) {
+    sink = nullptr;
+    lineBuffer = "";
+    Serial.println("ERROR: Serial capture timed out");
+  }
+}
+
+void SerialConsole::execute(const String& line) {
+  int space = line.indexOf(' ');
+  String name = (space < 0) ? line : line.substring(0, space);
+  String args = (space < 0) ? String("") : line.substring(space + 1);
+
+  if (name == "help") {
+    printHelp();
+    return;
+  }
+
+  for (int i = 0; i < commandCount; i++) {
+    if (name == commands[i].name) {
+      commands[i].handler(args);
+      return;
+    }
+  }
+
+  Serial.println("Unknown command: " + name + " (try 'help')");
+}
+
+void SerialConsole::printHelp() const {
+  Serial.println("Commands:");
+  for (int i = 0; i < commandCount; i++) {
+    Serial.printf("  %-10s %s\n", commands[i].name, commands[i].help);
+  }
+}
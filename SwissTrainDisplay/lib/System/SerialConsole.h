@@ -0,0 +1,52 @@
+#ifndef SERIALCONSOLE_H
+#define SERIALCONSOLE_H
+
+#include <Arduino.h>
+#include "../../include/Config.h"
+
+// ====== SERIAL CONSOLE ======
+// Line-based diagnostic commands over the serial monitor ("help" lists them).
+// poll() never blocks: it only consumes bytes that already arrived.
+
+typedef void (*ConsoleHandler)(const String& args);
+
+// Receives raw lines while capturing; return false to end the capture
+typedef bool (*ConsoleLineSink)(const String& line);
+
+struct ConsoleCommand {
+  const char* name;
+  const char* help;
+  ConsoleHandler handler;
+
+  ConsoleCommand() : name(""), help(""), handler(nullptr) {}
+};
+
+class SerialConsole {
+private:
+  ConsoleCommand commands[MAX_CONSOLE_COMMANDS];
+  int commandCount;
+  String lineBuffer;
+
+  // Capture mode - lines go to the sink instead of the command table
+  ConsoleLineSink sink;
+  unsigned long captureTimeoutMs;
+  unsigned long lastLineAt;
+
+  void execute(const String& line);
+  void printHelp() const;
+
+public:
+  SerialConsole();
+
+  bool addCommand(const char* name, const char* help, ConsoleHandler handler);
+
+  // Read pending input and run complete lines - call periodically
+  void poll();
+
+  // Route the following lines to sink until it returns false, or until
+  // no line arrives for timeoutMs (the sink then gets nothing more)
+  void capture(ConsoleLineSink lineSink, unsigned long timeoutMs);
+  bool isCapturing() const { return sink != nullptr; }
+};
+
+#endif // SERIALCONSOLE_H
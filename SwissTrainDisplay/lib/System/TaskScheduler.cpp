@@ -0,0 +1,181 @@
+#include "TaskScheduler.h"
+#include <limits.h>
+
+TaskScheduler::TaskScheduler()
+  : taskCount(0), idleHandler(nullptr), statsStartMs(0), lastPassUs(0),
+    passes(0), idlePasses(0), maxLoopGapUs(0) {
+}
+
+int TaskScheduler::addTask(const char* name, TaskCallback callback, unsigned long periodMs,
+                           unsigned long deadlineMs, unsigned long firstRunDelayMs) {
+  if (taskCount >= MAX_SCHEDULER_TASKS || callback == nullptr) {
+    Serial.printf("ERROR: Cannot add task %s\n", name);
+    return -1;
+  }
+
+  Task& task = tasks[taskCount];
+  task.name = name;
+  task.callback = callback;
+  task.periodMs = periodMs;
+  task.deadlineMs = deadlineMs;
+  task.nextRun = millis() + firstRunDelayMs;
+  task.enabled = true;
+  task.stats = TaskStats();
+
+  if (statsStartMs == 0) {
+    statsStartMs = millis();
+  }
+
+  Serial.printf("Task added: %s (every %lu ms)\n", name, periodMs);
+  return taskCount++;
+}
+
+void TaskScheduler::setEnabled(int id, bool enabled) {
+  if (id >= 0 && id < taskCount) {
+    tasks[id].enabled = enabled;
+    tasks[id].nextRun = millis();
+  }
+}
+
+void TaskScheduler::setPeriod(int id, unsigned long periodMs) {
+  if (id < 0 || id >= taskCount || tasks[id].periodMs == periodMs) {
+    return;
+  }
+  tasks[id].periodMs = periodMs;
+  // Shorter period takes effect now rather than after the old one
+  if ((long)(tasks[id].nextRun - (millis() + periodMs)) > 0) {
+    tasks[id].nextRun = millis() + periodMs;
+  }
+}
+
+void TaskScheduler::runNow(int id) {
+  if (id >= 0 && id < taskCount) {
+    tasks[id].nextRun = millis();
+  }
+}
+
+// ====== SCHEDULING ======
+
+void TaskScheduler::run() {
+  unsigned long passStart = micros();
+  if (lastPassUs != 0) {
+    uint32_t gap = passStart - lastPassUs;
+    if (gap > maxLoopGapUs) {
+      maxLoopGapUs = gap;
+    }
+  }
+  lastPassUs = passStart;
+  passes++;
+
+  bool ranTask = false;
+
+  // Tasks run in registration order, so register latency-critical ones first
+  for (int i = 0; i < taskCount; i++) {
+    Task& task = tasks[i];
+    unsigned long now = millis();
+    if (!task.enabled || (long)(now - task.nextRun) < 0) {
+      continue;
+    }
+
+    unsigned long lateness = now - task.nextRun;
+    if (lateness > task.stats.maxLatenessMs) {
+      task.stats.maxLatenessMs = lateness;
+    }
+    if (lateness > task.deadlineMs) {
+      task.stats.deadlineMisses++;
+    }
+
+    unsigned long start = micros();
+    task.callback();
+    uint32_t elapsed = micros() - start;
+
+    task.stats.runs++;
+    task.stats.totalTimeUs += elapsed;
+    if (elapsed > task.stats.maxTimeUs) {
+      task.stats.maxTimeUs = elapsed;
+    }
+
+    // Keep the cadence, but don't try to catch up on missed periods
+    task.nextRun += task.periodMs;
+    if ((long)(millis() - task.nextRun) >= 0) {
+      task.nextRun = millis() + task.periodMs;
+    }
+
+    ranTask = true;
+  }
+
+  if (!ranTask) {
+    idlePasses++;
+    if (idleHandler) {
+      idleHandler(timeUntilNextTask());
+    } else {
+      yield();  // Let the WiFi/TCP stack run
+    }
+  }
+}
+
+unsigned long TaskScheduler::timeUntilNextTask() const {
+  unsigned long now = millis();
+  unsigned long soonest = ULONG_MAX;
+
+  for (int i = 0; i < taskCount; i++) {
+    if (!tasks[i].enabled) {
+      continue;
+    }
+    long remaining = (long)(tasks[i].nextRun - now);
+    if (remaining <= 0) {
+      return 0;
+    }
+    if ((unsigned long)remaining < soonest) {
+      soonest = remaining;
+    }
+  }
+  return soonest;
+}
+
+// ====== STATISTICS ======
+
+const Task* TaskScheduler::getTask(int id) const {
+  if (id < 0 || id >= taskCount) {
+    return nullptr;
+  }
+  return &tasks[id];
+}
+
+void TaskScheduler::printStats() const {
+  unsigned long elapsedMs = millis() - statsStartMs;
+  if (elapsedMs == 0) {
+    elapsedMs = 1;
+  }
+
+  Serial.println("\n===== Scheduler stats =====");
+  Serial.printf("Window: %lu ms, passes: %lu, idle: %lu (%.1f%%)\n",
+                elapsedMs, (unsigned long)passes, (unsigned long)idlePasses,
+                passes > 0 ? 100.0f * idlePasses / passes : 0.0f);
+  Serial.printf("Loop jitter: max gap %lu us\n", (unsigned long)maxLoopGapUs);
+  Serial.println("Task        runs    cpu%   avg us   max us  late ms  misses");
+
+  for (int i = 0; i < taskCount; i++) {
+    const Task& task = tasks[i];
+    const TaskStats& st = task.stats;
+    float cpu = (st.totalTimeUs / 10.0f) / elapsedMs;  // us / (ms * 1000) * 100
+    uint32_t avg = st.runs > 0 ? (uint32_t)(st.totalTimeUs / st.runs) : 0;
+
+    Serial.printf("%-10s %6lu  %5.1f  %7lu  %7lu  %7lu  %6lu%s\n",
+                  task.name, (unsigned long)st.runs, cpu,
+                  (unsigned long)avg, (unsigned long)st.maxTimeUs,
+                  (unsigned long)st.maxLatenessMs, (unsigned long)st.deadlineMisses,
+                  task.enabled ? "" : " (off)");
+  }
+  Serial.println("===========================\n");
+}
+
+void TaskScheduler::resetStats() {
+  for (int i = 0; i < taskCount; i++) {
+    tasks[i].stats = TaskStats();
+  }
+  statsStartMs = millis();
+  passes = 0;
+  idlePasses = 0;
+  maxLoopGapUs = 0;
+}
@@ -0,0 +1,75 @@
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include <Arduino.h>
+#include "../../include/Config.h"
+
+// ====== COOPERATIVE TASK SCHEDULER ======
+// Runs periodic tasks from loop() when they are due and yields to the
+// WiFi stack otherwise. Tasks must return quickly (no delay()).
+
+typedef void (*TaskCallback)();
+
+// Called when a pass ran nothing; may sleep up to maxSleepMs
+typedef void (*IdleHandler)(unsigned long maxSleepMs);
+
+struct TaskStats {
+  uint32_t runs;
+  uint32_t deadlineMisses;   // Started later than their deadline
+  uint64_t totalTimeUs;      // CPU time spent in the task
+  uint32_t maxTimeUs;
+  uint32_t maxLatenessMs;    // Worst start delay vs. scheduled time
+
+  TaskStats() : runs(0), deadlineMisses(0), totalTimeUs(0), maxTimeUs(0), maxLatenessMs(0) {}
+};
+
+struct Task {
+  const char* name;
+  TaskCallback callback;
+  unsigned long periodMs;
+  unsigned long deadlineMs;  // Allowed start delay before counting a miss
+  unsigned long nextRun;
+  bool enabled;
+  TaskStats stats;
+
+  Task() : name(""), callback(nullptr), periodMs(0), deadlineMs(0), nextRun(0), enabled(true) {}
+};
+
+class TaskScheduler {
+private:
+  Task tasks[MAX_SCHEDULER_TASKS];
+  int taskCount;
+  IdleHandler idleHandler;
+
+  // Loop statistics
+  unsigned long statsStartMs;
+  unsigned long lastPassUs;
+  uint32_t passes;
+  uint32_t idlePasses;
+  uint32_t maxLoopGapUs;     // Longest time between two passes (loop jitter)
+
+public:
+  TaskScheduler();
+
+  // Register a task; returns its id or -1 if the table is full
+  int addTask(const char* name, TaskCallback callback, unsigned long periodMs,
+              unsigned long deadlineMs, unsigned long firstRunDelayMs = 0);
+  void setEnabled(int id, bool enabled);
+  void runNow(int id);  // Make a task due on the next pass
+  void setPeriod(int id, unsigned long periodMs);
+  void setIdleHandler(IdleHandler handler) { idleHandler = handler; }
+
+  // One scheduling pass - call from loop()
+  void run();
+
+  // Milliseconds until the next task is due (0 = something is due now)
+  unsigned long timeUntilNextTask() const;
+
+  // Statistics
+  const Task* getTask(int id) const;
+  int getTaskCount() const { return taskCount; }
+  void printStats() const;
+  void resetStats();
+};
+
+#endif // TASKSCHEDULER_H
@@ -1,7 +1,8 @@
 #include "DisplayManager.h"
 
 DisplayManager::DisplayManager()
-  : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET), initialized(false) {
+  : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET), initialized(false),
+    metricsClock(0), metricsHits(0), metricsMisses(0), flushCount(0), lastFlushEnd(0) {
 }
 
 bool DisplayManager::begin() {
@@ -32,19 +33,73 @@ void DisplayManager::clear() {
 
 void DisplayManager::show() {
   display.display();
+  flushCount++;
+  lastFlushEnd = micros();
+}
+
+void DisplayManager::showRegion(int y, int h) {
+  if (h <= 0) {
+    return;
+  }
+
+  // SSD1306 memory is organised in 8-pixel pages
+  int firstPage = max(0, y / 8);
+  int lastPage = min(SCREEN_HEIGHT / 8 - 1, (y + h - 1) / 8);
+  if (firstPage > lastPage) {
+    return;
+  }
+
+  display.ssd1306_command(SSD1306_PAGEADDR);
+  display.ssd1306_command(firstPage);
+  display.ssd1306_command(lastPage);
+  display.ssd1306_command(SSD1306_COLUMNADDR);
+  display.ssd1306_command(0);
+  display.ssd1306_command(SCREEN_WIDTH - 1);
+
+  const uint8_t* buf = display.getBuffer() + firstPage * SCREEN_WIDTH;
+  int count = (lastPage - firstPage + 1) * SCREEN_WIDTH;
+
+  Wire.setClock(I2C_CLOCK_HZ);
+  while (count > 0) {
+    int chunk = min(count, I2C_CHUNK_BYTES - 1);  // Leave room for control byte
+    Wire.beginTransmission(SCREEN_ADDRESS);
+    Wire.write((uint8_t)0x40);  // Co = 0, D/C = 1: data stream
+    for (int i = 0; i < chunk; i++) {
+      Wire.write(*buf++);
+    }
+    Wire.endTransmission();
+    count -= chunk;
+  }
+  Wire.setClock(100000);
+
+  flushCount++;
+  lastFlushEnd = micros();
 }
 
 void DisplayManager::clearYellowZone() {
-  display.fillRect(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT, SSD1306_BLACK);
+  fillRectFast(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT, false);
 }
 
 void DisplayManager::clearBlueZone() {
-  display.fillRect(0, BLUE_ZONE_Y, SCREEN_WIDTH, BLUE_ZONE_HEIGHT, SSD1306_BLACK);
+  fillRectFast(0, BLUE_ZONE_Y, SCREEN_WIDTH, BLUE_ZONE_HEIGHT, false);
 }
 
 // ====== DRAWING HELPERS ======
 
+bool DisplayManager::drawFromAtlas(const String& text, int x, int y, int size, bool inverted) {
+  if (inverted || !GlyphAtlas::supports(text.c_str(), size)) {
+    return false;
+  }
+
+  GlyphAtlas::drawText(display.getBuffer(), text.c_str(), x, y, size);
+  return true;
+}
+
 void DisplayManager::drawText(const String& text, int x, int y, int size, bool inverted) {
+  if (drawFromAtlas(text, x, y, size, inverted)) {
+    return;
+  }
+
   display.setTextSize(size);
   display.setTextColor(inverted ? SSD1306_BLACK : SSD1306_WHITE);
   display.setCursor(x, y);
@@ -52,13 +107,13 @@ void DisplayManager::drawText(const String& text, int x, int y, int size, bool i
 }
 
 void DisplayManager::drawCenteredText(const String& text, int y, int size, bool inverted) {
+  uint16_t w = getTextWidth(text, size);
   display.setTextSize(size);
 
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-
   int x = (SCREEN_WIDTH - w) / 2;
+  if (drawFromAtlas(text, x, y, size, inverted)) {
+    return;
+  }
 
   display.setTextColor(inverted ? SSD1306_BLACK : SSD1306_WHITE);
   display.setCursor(x, y);
@@ -66,26 +121,86 @@ void DisplayManager::drawCenteredText(const String& text, int y, int size, bool
 }
 
 void DisplayManager::drawRightAlignedText(const String& text, int y, int size, bool inverted) {
+  uint16_t w = getTextWidth(text, size);
   display.setTextSize(size);
 
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-
   int x = SCREEN_WIDTH - w - 2;  // 2px margin from right
+  if (drawFromAtlas(text, x, y, size, inverted)) {
+    return;
+  }
 
   display.setTextColor(inverted ? SSD1306_BLACK : SSD1306_WHITE);
   display.setCursor(x, y);
   display.print(text);
 }
 
+// ====== TEXT METRICS ======
+
+uint32_t DisplayManager::hashText(const char* text, uint16_t& length) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  length = 0;
+  for (const char* p = text; *p; p++) {
+    hash ^= (uint8_t)*p;
+    hash *= 16777619u;
+    length++;
+  }
+  return hash;
+}
+
+uint16_t DisplayManager::getTextWidth(const char* text, int size) {
+  uint16_t length;
+  uint32_t hash = hashText(text, length);
+  metricsClock++;
+
+  // Look up cached width, remembering the least recently used slot
+  int victim = 0;
+  for (int i = 0; i < TEXT_METRICS_CACHE_SIZE; i++) {
+    TextMetricsEntry& entry = metricsCache[i];
+    if (entry.lastUsed != 0 && entry.hash == hash &&
+        entry.length == length && entry.size == size) {
+      entry.lastUsed = metricsClock;
+      metricsHits++;
+      return entry.width;
+    }
+    if (entry.lastUsed < metricsCache[victim].lastUsed) {
+      victim = i;
+    }
+  }
+
+  // Miss - measure with Adafruit_GFX and store
+  int16_t x1, y1;
+  uint16_t w, h;
+  display.setTextSize(size);
+  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+
+  TextMetricsEntry& slot = metricsCache[victim];
+  slot.hash = hash;
+  slot.length = length;
+  slot.size = size;
+  slot.width = w;
+  slot.lastUsed = metricsClock;
+
+  metricsMisses++;
+  return w;
+}
+
+void DisplayManager::clearTextMetricsCache() {
+  for (int i = 0; i < TEXT_METRICS_CACHE_SIZE; i++) {
+    metricsCache[i] = TextMetricsEntry();
+  }
+  metricsClock = 0;
+  metricsHits = 0;
+  metricsMisses = 0;
+}
+
 // ====== SHAPE HELPERS ======
 
 void DisplayManager::drawRect(int x, int y, int w, int h, bool filled) {
   if (filled) {
-    display.fillRect(x, y, w, h, SSD1306_WHITE);
+    fillRectFast(x, y, w, h);
   } else {
-    display.drawRect(x, y, w, h, SSD1306_WHITE);
+    drawRectFast(x, y, w, h);
   }
 }
 
@@ -100,3 +215,94 @@ void DisplayManager::drawCircle(int x, int y, int r, bool filled) {
 void DisplayManager::drawLine(int x0, int y0, int x1, int y1) {
   display.drawLine(x0, y0, x1, y1, SSD1306_WHITE);
 }
+
+// ====== DIRECT FRAMEBUFFER RENDERING ======
+// SSD1306 buffer layout: 8 pages of 128 bytes, one byte per column,
+// bit 0 = top row of the page.
+
+// Mask operations applied per byte
+enum FramebufferOp { FB_SET, FB_CLEAR, FB_INVERT };
+
+static void applySpan(uint8_t* buffer, int x, int y, int w, int h, FramebufferOp op) {
+  // Clip to screen
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+  if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+
+  int lastY = y + h - 1;
+  for (int page = y >> 3; page <= (lastY >> 3); page++) {
+    // Rows of this page covered by the rectangle
+    int top = max(y, page * 8) & 7;
+    int bottom = min(lastY, page * 8 + 7) & 7;
+    uint8_t mask = (uint8_t)((0xFF << top) & (0xFF >> (7 - bottom)));
+
+    uint8_t* dst = buffer + page * SCREEN_WIDTH + x;
+    uint8_t* end = dst + w;
+    switch (op) {
+      case FB_SET:
+        if (mask == 0xFF) { memset(dst, 0xFF, w); break; }
+        while (dst < end) *dst++ |= mask;
+        break;
+      case FB_CLEAR:
+        if (mask == 0xFF) { memset(dst, 0x00, w); break; }
+        while (dst < end) *dst++ &= ~mask;
+        break;
+      case FB_INVERT:
+        while (dst < end) *dst++ ^= mask;
+        break;
+    }
+  }
+}
+
+void DisplayManager::fillRectFast(int x, int y, int w, int h, bool white) {
+  applySpan(display.getBuffer(), x, y, w, h, white ? FB_SET : FB_CLEAR);
+}
+
+void DisplayManager::invertRect(int x, int y, int w, int h) {
+  applySpan(display.getBuffer(), x, y, w, h, FB_INVERT);
+}
+
+void DisplayManager::drawRectFast(int x, int y, int w, int h, bool white) {
+  drawHLineFast(x, y, w, white);
+  drawHLineFast(x, y + h - 1, w, white);
+  drawVLineFast(x, y, h, white);
+  drawVLineFast(x + w - 1, y, h, white);
+}
+
+void DisplayManager::drawBitmapFast(int x, int y, const uint16_t* columns, int w, int h, bool white) {
+  if (y <= -h || y >= SCREEN_HEIGHT) {
+    return;
+  }
+
+  uint8_t* buffer = display.getBuffer();
+  uint16_t heightMask = (h >= 16) ? 0xFFFF : (uint16_t)((1u << h) - 1);
+
+  for (int col = 0; col < w; col++) {
+    int px = x + col;
+    if (px < 0 || px >= SCREEN_WIDTH) {
+      continue;
+    }
+
+    uint32_t bits = pgm_read_word(&columns[col]) & heightMask;
+    if (bits == 0) {
+      continue;
+    }
+
+    // Align column to page boundaries (bitmap may start above the screen)
+    int page = y >> 3;
+    int shift = y & 7;
+    bits <<= shift;
+    for (; bits != 0 && page < SCREEN_HEIGHT / 8; page++, bits >>= 8) {
+      if (page < 0) {
+        continue;
+      }
+      uint8_t mask = (uint8_t)bits;
+      uint8_t& dst = buffer[page * SCREEN_WIDTH + px];
+      dst = white ? (dst | mask) : (dst & ~mask);
+    }
+  }
+}
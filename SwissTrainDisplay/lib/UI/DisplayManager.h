@@ -6,12 +6,41 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include "../../include/Config.h"
+#include "GlyphAtlas.h"
+
+// ====== TEXT METRICS CACHE ENTRY ======
+// Width of a string at a given text size, keyed by FNV-1a hash
+
+struct TextMetricsEntry {
+  uint32_t hash;
+  uint16_t length;
+  uint8_t size;
+  uint16_t width;
+  uint32_t lastUsed;  // 0 = empty slot
+
+  TextMetricsEntry() : hash(0), length(0), size(0), width(0), lastUsed(0) {}
+};
 
 class DisplayManager {
 private:
   Adafruit_SSD1306 display;
   bool initialized;
 
+  // Text metrics cache (avoids getTextBounds on every frame)
+  TextMetricsEntry metricsCache[TEXT_METRICS_CACHE_SIZE];
+  uint32_t metricsClock;
+  uint32_t metricsHits;
+  uint32_t metricsMisses;
+
+  // Flush tracking (input-to-photon latency)
+  uint32_t flushCount;
+  unsigned long lastFlushEnd;  // micros() when the last flush finished
+
+  static uint32_t hashText(const char* text, uint16_t& length);
+
+  // Large digits come from the PROGMEM glyph atlas when possible
+  bool drawFromAtlas(const String& text, int x, int y, int size, bool inverted);
+
 public:
   DisplayManager();
 
@@ -25,6 +54,9 @@ public:
   // Basic operations
   void clear();
   void show();
+  void showRegion(int y, int h);  // Flush only the pages covering rows y..y+h-1
+  uint32_t getFlushCount() const { return flushCount; }
+  unsigned long getLastFlushEnd() const { return lastFlushEnd; }
   void clearYellowZone();
   void clearBlueZone();
 
@@ -33,6 +65,13 @@ public:
   void drawCenteredText(const String& text, int y, int size = 1, bool inverted = false);
   void drawRightAlignedText(const String& text, int y, int size = 1, bool inverted = false);
 
+  // Text metrics (memoized)
+  uint16_t getTextWidth(const char* text, int size = 1);
+  uint16_t getTextWidth(const String& text, int size = 1) { return getTextWidth(text.c_str(), size); }
+  void clearTextMetricsCache();
+  uint32_t getTextMetricsHits() const { return metricsHits; }
+  uint32_t getTextMetricsMisses() const { return metricsMisses; }
+
   // Zone helpers
   bool isInYellowZone(int y) const { return y < YELLOW_ZONE_HEIGHT; }
   bool isInBlueZone(int y) const { return y >= BLUE_ZONE_Y; }
@@ -42,6 +81,15 @@ public:
   void drawCircle(int x, int y, int r, bool filled = false);
   void drawLine(int x0, int y0, int x1, int y1);
 
+  // Direct framebuffer rendering (byte-wise, no per-pixel GFX calls)
+  void fillRectFast(int x, int y, int w, int h, bool white = true);
+  void invertRect(int x, int y, int w, int h);
+  void drawHLineFast(int x, int y, int w, bool white = true) { fillRectFast(x, y, w, 1, white); }
+  void drawVLineFast(int x, int y, int h, bool white = true) { fillRectFast(x, y, 1, h, white); }
+  void drawRectFast(int x, int y, int w, int h, bool white = true);
+  // PROGMEM bitmap stored as one uint16_t per column, LSB = top row (h <= 16)
+  void drawBitmapFast(int x, int y, const uint16_t* columns, int w, int h, bool white = true);
+
   // Status
   bool isInitialized() const { return initialized; }
 };
@@ -0,0 +1,106 @@
+#include "GlyphAtlas.h"
+
+// ====== GLYPH DATA ======
+// 5x7 digits scaled 2x and 3x, one entry per column, LSB = top row.
+// Same cell metrics as the built-in font (6 px advance per size unit)
+// so layouts don't move, with an open zero and a heavier colon that
+// read better at a distance than the classic font's slashed zero.
+
+static const char GLYPH_CHARS[] = "0123456789:";
+static const int GLYPH_COUNT = sizeof(GLYPH_CHARS) - 1;
+
+static const uint16_t GLYPHS_2X[GLYPH_COUNT][5 * 2] PROGMEM = {
+  {0x0FFC, 0x0FFC, 0x3003, 0x3003, 0x3003, 0x3003, 0x3003, 0x3003, 0x0FFC, 0x0FFC},  // '0'
+  {0x0000, 0x0000, 0x300C, 0x300C, 0x3FFF, 0x3FFF, 0x3000, 0x3000, 0x0000, 0x0000},  // '1'
+  {0x300C, 0x300C, 0x3C03, 0x3C03, 0x3303, 0x3303, 0x30C3, 0x30C3, 0x303C, 0x303C},  // '2'
+  {0x0C03, 0x0C03, 0x3003, 0x3003, 0x3033, 0x3033, 0x30CF, 0x30CF, 0x0F03, 0x0F03},  // '3'
+  {0x03C0, 0x03C0, 0x0330, 0x0330, 0x030C, 0x030C, 0x3FFF, 0x3FFF, 0x0300, 0x0300},  // '4'
+  {0x0C3F, 0x0C3F, 0x3033, 0x3033, 0x3033, 0x3033, 0x3033, 0x3033, 0x0FC3, 0x0FC3},  // '5'
+  {0x0FF0, 0x0FF0, 0x30CC, 0x30CC, 0x30C3, 0x30C3, 0x30C3, 0x30C3, 0x0F00, 0x0F00},  // '6'
+  {0x0003, 0x0003, 0x3F03, 0x3F03, 0x00C3, 0x00C3, 0x0033, 0x0033, 0x000F, 0x000F},  // '7'
+  {0x0F3C, 0x0F3C, 0x30C3, 0x30C3, 0x30C3, 0x30C3, 0x30C3, 0x30C3, 0x0F3C, 0x0F3C},  // '8'
+  {0x003C, 0x003C, 0x30C3, 0x30C3, 0x30C3, 0x30C3, 0x0CC3, 0x0CC3, 0x03FC, 0x03FC},  // '9'
+  {0x0000, 0x0000, 0x0F3C, 0x0F3C, 0x0F3C, 0x0F3C, 0x0000, 0x0000, 0x0000, 0x0000},  // ':'
+};
+
+static const uint32_t GLYPHS_3X[GLYPH_COUNT][5 * 3] PROGMEM = {
+  {0x03FFF8, 0x03FFF8, 0x03FFF8, 0x1C0007, 0x1C0007, 0x1C0007, 0x1C0007, 0x1C0007, 0x1C0007, 0x1C0007, 0x1C0007, 0x1C0007, 0x03FFF8, 0x03FFF8, 0x03FFF8},  // '0'
+  {0x000000, 0x000000, 0x000000, 0x1C0038, 0x1C0038, 0x1C0038, 0x1FFFFF, 0x1FFFFF, 0x1FFFFF, 0x1C0000, 0x1C0000, 0x1C0000, 0x000000, 0x000000, 0x000000},  // '1'
+  {0x1C0038, 0x1C0038, 0x1C0038, 0x1F8007, 0x1F8007, 0x1F8007, 0x1C7007, 0x1C7007, 0x1C7007, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C01F8, 0x1C01F8, 0x1C01F8},  // '2'
+  {0x038007, 0x038007, 0x038007, 0x1C0007, 0x1C0007, 0x1C0007, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x1C0E3F, 0x1C0E3F, 0x1C0E3F, 0x03F007, 0x03F007, 0x03F007},  // '3'
+  {0x007E00, 0x007E00, 0x007E00, 0x0071C0, 0x0071C0, 0x0071C0, 0x007038, 0x007038, 0x007038, 0x1FFFFF, 0x1FFFFF, 0x1FFFFF, 0x007000, 0x007000, 0x007000},  // '4'
+  {0x0381FF, 0x0381FF, 0x0381FF, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x1C01C7, 0x03FE07, 0x03FE07, 0x03FE07},  // '5'
+  {0x03FFC0, 0x03FFC0, 0x03FFC0, 0x1C0E38, 0x1C0E38, 0x1C0E38, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x03F000, 0x03F000, 0x03F000},  // '6'
+  {0x000007, 0x000007, 0x000007, 0x1FF007, 0x1FF007, 0x1FF007, 0x000E07, 0x000E07, 0x000E07, 0x0001C7, 0x0001C7, 0x0001C7, 0x00003F, 0x00003F, 0x00003F},  // '7'
+  {0x03F1F8, 0x03F1F8, 0x03F1F8, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x03F1F8, 0x03F1F8, 0x03F1F8},  // '8'
+  {0x0001F8, 0x0001F8, 0x0001F8, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x1C0E07, 0x038E07, 0x038E07, 0x038E07, 0x007FF8, 0x007FF8, 0x007FF8},  // '9'
+  {0x000000, 0x000000, 0x000000, 0x03F1F8, 0x03F1F8, 0x03F1F8, 0x03F1F8, 0x03F1F8, 0x03F1F8, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000},  // ':'
+};
+
+// ====== LOOKUP ======
+
+int GlyphAtlas::glyphIndex(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c == ':') {
+    return 10;
+  }
+  return -1;
+}
+
+bool GlyphAtlas::supports(char c, int size) {
+  return (size == 2 || size == 3) && (c == ' ' || glyphIndex(c) >= 0);
+}
+
+bool GlyphAtlas::supports(const char* text, int size) {
+  for (const char* p = text; *p; p++) {
+    if (!supports(*p, size)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ====== BLIT ======
+
+void GlyphAtlas::blit(uint8_t* buffer, char c, int x, int y, int size) {
+  int index = glyphIndex(c);
+  if (index < 0 || y < 0 || y >= SCREEN_HEIGHT) {
+    return;  // Spaces and unsupported glyphs draw nothing
+  }
+
+  int page = y >> 3;
+  int shift = y & 7;
+  int columns = 5 * size;
+
+  for (int col = 0; col < columns; col++) {
+    int px = x + col;
+    if (px < 0 || px >= SCREEN_WIDTH) {
+      continue;
+    }
+
+    uint32_t bits = (size == 2) ? pgm_read_word(&GLYPHS_2X[index][col])
+                                : pgm_read_dword(&GLYPHS_3X[index][col]);
+    if (bits == 0) {
+      continue;
+    }
+
+    // OR the column into consecutive pages of the framebuffer
+    uint64_t column = (uint64_t)bits << shift;
+    uint8_t* dst = buffer + page * SCREEN_WIDTH + px;
+    for (int p = page; column != 0 && p < SCREEN_HEIGHT / 8; p++) {
+      *dst |= (uint8_t)column;
+      column >>= 8;
+      dst += SCREEN_WIDTH;
+    }
+  }
+}
+
+int GlyphAtlas::drawText(uint8_t* buffer, const char* text, int x, int y, int size) {
+  for (const char* p = text; *p; p++) {
+    blit(buffer, *p, x, y, size);
+    x += 6 * size;
+  }
+  return x;
+}
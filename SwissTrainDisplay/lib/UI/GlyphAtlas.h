@@ -0,0 +1,26 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <Arduino.h>
+#include "../../include/Config.h"
+
+// ====== GLYPH ATLAS ======
+// Pre-rendered PROGMEM bitmaps for the large time digits (text size 2
+// and 3), blitted straight into the SSD1306 framebuffer instead of
+// letting Adafruit_GFX scale the 5x7 font with one fillRect per pixel.
+
+class GlyphAtlas {
+private:
+  static int glyphIndex(char c);
+  static void blit(uint8_t* buffer, char c, int x, int y, int size);
+
+public:
+  // Whether a character / whole string can be drawn from the atlas
+  static bool supports(char c, int size);
+  static bool supports(const char* text, int size);
+
+  // Draw white text into the framebuffer; returns the x after the last glyph
+  static int drawText(uint8_t* buffer, const char* text, int x, int y, int size);
+};
+
+#endif // GLYPHATLAS_H
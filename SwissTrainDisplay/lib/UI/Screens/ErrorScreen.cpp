@@ -36,7 +36,7 @@ void ErrorScreen::draw() {
   display->clear();
 
   // Yellow zone: ERROR title with icon
-  YellowBar::draw(*display, "ERROR");
+  YellowBar::draw(*display, F("ERROR"));
   Icons::drawError(*display, 115, 8);
 
   // Blue zone: Error message
@@ -46,7 +46,7 @@ void ErrorScreen::draw() {
     display->drawText(error.detail.substring(0, 20), 4, 32, 1);
   }
 
-  display->drawText("Press any button", 4, 50, 1);
+  display->drawText(F("Press any button"), 4, 50, 1);
 
   display->show();
 }
@@ -6,6 +6,7 @@ MainScreen::MainScreen(DisplayManager* disp, PresetManager* presetMgr, TrainAPI*
 
 void MainScreen::enter() {
   Serial.println("Entering MainScreen");
+  titleMarquee.reset();
 
   // Don't fetch data here - it blocks for 1-5 seconds!
   // Display will show cached data or "No data" message
@@ -34,6 +35,16 @@ void MainScreen::update() {
       requestRedraw();
     }
   }
+
+  // Animate the connection progress while WiFi comes up
+  if (wifi->isConnectingNow() && ActivityIndicator::frameChanged()) {
+    requestRedraw();
+  }
+
+  // Scroll long titles; the render task repaints and flushes only the yellow zone
+  if (current && titleMarquee.tick()) {
+    invalidateRegion(0, YELLOW_ZONE_HEIGHT);
+  }
 }
 
 void MainScreen::handleEncoder(int delta) {
@@ -44,6 +55,7 @@ void MainScreen::handleEncoder(int delta) {
     } else {
       presets->previousEnabled();
     }
+    titleMarquee.reset();  // Hold until the new title is drawn
 
     // Don't fetch data here - it blocks for 1-5 seconds!
     // User can manually refresh from menu if needed
@@ -60,16 +72,26 @@ void MainScreen::handleShortPress() {
 }
 
 void MainScreen::handleLongPress() {
-  // Long press opens main menu
+  // Long press cancels a pending WiFi connection, otherwise opens main menu
+  if (wifi->isConnectingNow()) {
+    wifi->cancelConnect();
+    return;
+  }
   requestState(STATE_MENU);
 }
 
+bool MainScreen::needsContinuousRefresh() const {
+  // The clock ticks every second; the marquee is allowed to slow down
+  const PresetSummary* current = presets->getCurrentSummary();
+  return (current && current->type == PRESET_CLOCK) || wifi->isConnectingNow();
+}
+
 void MainScreen::draw() {
   display->clear();
 
   const Preset* current = presets->getCurrent();
   if (!current) {
-    display->drawCenteredText("No presets", 28, 1);
+    display->drawCenteredText(F("No presets"), 28, 1);
     display->show();
     return;
   }
@@ -93,21 +115,35 @@ void MainScreen::draw() {
   display->show();
 }
 
+void MainScreen::drawRegion() {
+  YellowBar::draw(*display, titleMarquee, true, wifi->isConnected());
+}
+
+void MainScreen::drawTitleBar(const String& title) {
+  titleMarquee.setText(*display, title, YellowBar::titleWidth(true));
+  YellowBar::draw(*display, titleMarquee, true, wifi->isConnected());
+}
+
 void MainScreen::drawTrainDisplay() {
   const Preset* current = presets->getCurrent();
 
   // Yellow zone: Route information
   String route = current->fromStation + " -> " + current->toStation;
-  YellowBar::draw(*display, route, true, wifi->isConnected());
+  drawTitleBar(route);
 
   // Check if we have cached data
   if (!trainAPI->hasCachedData()) {
     // No data yet
-    if (!wifi->isConnected()) {
-      display->drawCenteredText("No WiFi", 30, 1);
-      display->drawCenteredText("Long press for menu", 42, 1);
+    if (wifi->isConnectingNow()) {
+      display->drawCenteredText(F("Connecting WiFi..."), 22, 1);
+      ActivityIndicator::draw(*display, SCREEN_WIDTH / 2, 34);
+      ProgressBar::draw(*display, 14, 44, SCREEN_WIDTH - 28, 6, wifi->getConnectProgress(), 100);
+      display->drawCenteredText(F("Long press: cancel"), 54, 1);
+    } else if (!wifi->isConnected()) {
+      display->drawCenteredText(F("No WiFi"), 30, 1);
+      display->drawCenteredText(F("Long press for menu"), 42, 1);
     } else {
-      display->drawCenteredText("Loading...", 35, 1);
+      display->drawCenteredText(F("Loading..."), 35, 1);
     }
     return;
   }
@@ -116,7 +152,7 @@ void MainScreen::drawTrainDisplay() {
   const std::vector<TrainConnection>& connections = trainAPI->getCachedConnections();
 
   if (connections.empty()) {
-    display->drawCenteredText("No connections", 35, 1);
+    display->drawCenteredText(F("No connections"), 35, 1);
     return;
   }
 
@@ -138,7 +174,7 @@ void MainScreen::drawClockDisplay() {
   const Preset* current = presets->getCurrent();
 
   // Yellow zone: Title
-  YellowBar::draw(*display, current->name, true, wifi->isConnected());
+  drawTitleBar(current->name);
 
   // Blue zone: Large time display
   String timeStr = getCurrentTime();
@@ -148,21 +184,21 @@ void MainScreen::drawClockDisplay() {
 void MainScreen::drawWeatherDisplay() {
   const Preset* current = presets->getCurrent();
 
-  YellowBar::draw(*display, current->name, true, wifi->isConnected());
+  drawTitleBar(current->name);
 
   // Placeholder
-  display->drawCenteredText("Weather Mode", 28, 1);
-  display->drawCenteredText("(Coming soon)", 40, 1);
+  display->drawCenteredText(F("Weather Mode"), 28, 1);
+  display->drawCenteredText(F("(Coming soon)"), 40, 1);
 }
 
 void MainScreen::drawCalendarDisplay() {
   const Preset* current = presets->getCurrent();
 
-  YellowBar::draw(*display, current->name, true, wifi->isConnected());
+  drawTitleBar(current->name);
 
   // Placeholder
-  display->drawCenteredText("Calendar Mode", 28, 1);
-  display->drawCenteredText("(Coming soon)", 40, 1);
+  display->drawCenteredText(F("Calendar Mode"), 28, 1);
+  display->drawCenteredText(F("(Coming soon)"), 40, 1);
 }
 
 // ====== MULTI-TRAIN DISPLAY LAYOUTS ======
@@ -171,15 +207,13 @@ void MainScreen::drawSingleTrain(const TrainConnection& conn) {
   Adafruit_SSD1306& d = display->getDisplay();
 
   if (conn.isCancelled) {
-    display->drawCenteredText("CANCELLED", 32, 2);
+    display->drawCenteredText(F("CANCELLED"), 32, 2);
     return;
   }
 
   // Large departure time
-  d.setTextSize(2);
+  display->drawText(conn.departureTime, 2, 20, 2);
   d.setTextColor(SSD1306_WHITE);
-  d.setCursor(2, 20);
-  d.print(conn.departureTime);
 
   // Show delay if any
   if (conn.delayMinutes > 0) {
@@ -196,11 +230,11 @@ void MainScreen::drawSingleTrain(const TrainConnection& conn) {
   // Platform and duration
   d.setTextSize(1);
   d.setCursor(2, 45);
-  d.print("Pl ");
+  d.print(F("Pl "));
   d.print(conn.platform);
 
   d.setCursor(2, 55);
-  d.print("Duration: ");
+  d.print(F("Duration: "));
   d.print(duration);
 }
 
@@ -216,7 +250,7 @@ void MainScreen::drawTwoTrains(const std::vector<TrainConnection>& connections)
 
     if (conn.isCancelled) {
       d.setCursor(2, y);
-      d.print("CANCELLED");
+      d.print(F("CANCELLED"));
     } else {
       // Departure time + delay (first line)
       d.setCursor(2, y);
@@ -235,7 +269,7 @@ void MainScreen::drawTwoTrains(const std::vector<TrainConnection>& connections)
 
       // Platform (second line)
       d.setCursor(2, y + 10);
-      d.print("Pl ");
+      d.print(F("Pl "));
       d.print(conn.platform);
     }
   }
@@ -253,7 +287,7 @@ void MainScreen::drawThreeTrains(const std::vector<TrainConnection>& connections
     if (conn.isCancelled) {
       d.setTextSize(1);
       d.setCursor(2, y);
-      d.print("CANCELLED");
+      d.print(F("CANCELLED"));
     } else {
       // Departure time (slightly bigger)
       d.setTextSize(1);
@@ -296,7 +330,7 @@ void MainScreen::drawFourTrains(const std::vector<TrainConnection>& connections)
 
     if (conn.isCancelled) {
       d.setCursor(x + 2, y);
-      d.print("CANC");
+      d.print(F("CANC"));
     } else {
       // Line 1: Departure time
       d.setCursor(x + 2, y);
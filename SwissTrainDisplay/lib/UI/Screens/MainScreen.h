@@ -12,7 +12,9 @@ private:
   PresetManager* presets;
   TrainAPI* trainAPI;
   WiFiManager* wifi;
+  Marquee titleMarquee;  // Scrolls long route names / titles
 
+  void drawTitleBar(const String& title);
   void drawTrainDisplay();
   void drawClockDisplay();
   void drawWeatherDisplay();
@@ -38,8 +40,10 @@ public:
   void handleEncoder(int delta) override;
   void handleShortPress() override;
   void handleLongPress() override;
+  bool needsContinuousRefresh() const override;
 
   void draw() override;
+  void drawRegion() override;  // Title marquee step
 };
 
 #endif // MAINSCREEN_H
@@ -3,10 +3,10 @@
 MenuScreen::MenuScreen(DisplayManager* disp, WiFiManager* wifiMgr, PresetManager* presetMgr, TrainAPI* api)
   : Screen(disp), wifi(wifiMgr), presets(presetMgr), trainAPI(api), selection(0) {
 
-  menuItems[0] = "Settings";
-  menuItems[1] = "Presets";
-  menuItems[2] = "Refresh";
-  menuItems[3] = "< Back";
+  menuItems[0] = F("Settings");
+  menuItems[1] = F("Presets");
+  menuItems[2] = F("Refresh");
+  menuItems[3] = F("< Back");
 }
 
 void MenuScreen::enter() {
@@ -65,7 +65,7 @@ void MenuScreen::draw() {
   display->clear();
 
   // Yellow zone: Title
-  YellowBar::drawWithTime(*display, "MAIN MENU");
+  YellowBar::drawWithTime(*display, F("MAIN MENU"));
 
   // Blue zone: Menu items
   menuList.draw(*display, menuItems, MENU_ITEM_COUNT, BLUE_ZONE_Y + 2);
@@ -86,7 +86,7 @@ void MenuScreen::performRefresh() {
   if (!wifi->isConnected()) {
     Serial.println("No WiFi connection - cannot refresh");
     display->clear();
-    display->drawCenteredText("No WiFi", 30, 1);
+    display->drawCenteredText(F("No WiFi"), 30, 1);
     display->show();
     delay(1500);
     return;
@@ -94,7 +94,7 @@ void MenuScreen::performRefresh() {
 
   // Show loading message
   display->clear();
-  display->drawCenteredText("Refreshing...", 28, 1);
+  display->drawCenteredText(F("Refreshing..."), 28, 1);
   display->show();
 
   // Fetch train data with the correct number of trains
@@ -111,7 +111,7 @@ void MenuScreen::performRefresh() {
   } else {
     Serial.println("Refresh failed");
     display->clear();
-    display->drawCenteredText("Refresh failed", 28, 1);
+    display->drawCenteredText(F("Refresh failed"), 28, 1);
     display->show();
     delay(1500);
   }
@@ -1,7 +1,8 @@
 #include "PasswordEntryScreen.h"
 
 PasswordEntryScreen::PasswordEntryScreen(DisplayManager* disp, WiFiManager* wifiMgr, SettingsManager* settingsMgr)
-  : Screen(disp), wifi(wifiMgr), settings(settingsMgr), password(""), charIndex(0), showModal(false), modalSelection(0) {
+  : Screen(disp), wifi(wifiMgr), settings(settingsMgr), password(""), charIndex(0), showModal(false), modalSelection(0),
+    connecting(false), connectFailed(false) {
 }
 
 void PasswordEntryScreen::enter() {
@@ -10,26 +11,72 @@ void PasswordEntryScreen::enter() {
   charIndex = 0;
   showModal = false;
   modalSelection = 0;
+  connecting = false;
+  connectFailed = false;
 }
 
-void PasswordEntryScreen::exit() {}
-void PasswordEntryScreen::update() {}
+void PasswordEntryScreen::exit() {
+  // Leaving mid-attempt abandons it
+  if (connecting) {
+    wifi->cancelConnect();
+    connecting = false;
+  }
+}
+
+void PasswordEntryScreen::update() {
+  if (!connecting) {
+    return;
+  }
+
+  // StateMachine polls WiFiManager; react to the outcome here
+  switch (wifi->getConnectState()) {
+    case WIFI_STATE_CONNECTED:
+      connecting = false;
+      settings->saveWiFiCredentials(ssid, password);
+      requestState(STATE_MAIN_DISPLAY);
+      break;
+    case WIFI_STATE_FAILED:
+      connecting = false;
+      connectFailed = true;
+      requestRedraw();
+      break;
+    case WIFI_STATE_CANCELLED:
+    case WIFI_STATE_IDLE:
+      connecting = false;
+      requestRedraw();
+      break;
+    case WIFI_STATE_CONNECTING:
+      if (ActivityIndicator::frameChanged()) {
+        requestRedraw();
+      }
+      break;
+  }
+}
 
 void PasswordEntryScreen::handleEncoder(int delta) {
-  if (delta == 0) return;
+  if (delta == 0 || connecting || connectFailed) return;
 
   if (showModal) {
     modalSelection += delta;
     if (modalSelection < 0) modalSelection = 3;
     if (modalSelection > 3) modalSelection = 0;
   } else {
-    charIndex += delta;
-    if (charIndex < 0) charIndex = KEYBOARD_CHARS_COUNT - 1;
-    if (charIndex >= KEYBOARD_CHARS_COUNT) charIndex = 0;
+    // Modular wrap keeps accelerated steps consistent across the ends
+    charIndex = ((charIndex + delta) % KEYBOARD_CHARS_COUNT + KEYBOARD_CHARS_COUNT) % KEYBOARD_CHARS_COUNT;
   }
 }
 
 void PasswordEntryScreen::handleShortPress() {
+  if (connecting) {
+    return;  // Long press cancels
+  }
+
+  if (connectFailed) {
+    // Back to the modal to fix the password or exit
+    connectFailed = false;
+    return;
+  }
+
   if (showModal) {
     switch (modalSelection) {
       case 0: // Del
@@ -37,12 +84,8 @@ void PasswordEntryScreen::handleShortPress() {
           password.remove(password.length() - 1);
         }
         break;
-      case 1: // Save & Connect
-        Serial.println("Connecting to: " + ssid);
-        if (wifi->connect(ssid, password)) {
-          settings->saveWiFiCredentials(ssid, password);
-        }
-        requestState(STATE_MAIN_DISPLAY);
+      case 1: // Save & Connect - credentials are saved once we get an IP
+        connecting = wifi->connect(ssid, password);
         break;
       case 2: // Edit
         showModal = false;
@@ -53,11 +96,21 @@ void PasswordEntryScreen::handleShortPress() {
     }
   } else {
     // Add character
-    password += KEYBOARD_CHARS[charIndex];
+    password += charsetAt(KEYBOARD_CHARS, charIndex);
   }
 }
 
 void PasswordEntryScreen::handleLongPress() {
+  if (connecting) {
+    wifi->cancelConnect();
+    return;  // update() picks up the cancelled state
+  }
+
+  if (connectFailed) {
+    connectFailed = false;
+    return;
+  }
+
   showModal = !showModal;
   if (showModal) {
     modalSelection = 0;
@@ -67,12 +120,16 @@ void PasswordEntryScreen::handleLongPress() {
 void PasswordEntryScreen::draw() {
   display->clear();
 
-  if (showModal) {
+  if (connecting) {
+    drawConnecting();
+  } else if (connectFailed) {
+    drawFailed();
+  } else if (showModal) {
     // Custom confirmation modal layout
     Adafruit_SSD1306& d = display->getDisplay();
 
     // Yellow bar: "Connect to"
-    YellowBar::draw(*display, "Connect to");
+    YellowBar::draw(*display, F("Connect to"));
 
     // Blue zone: WiFi name (first 15 chars)
     d.setTextSize(1);
@@ -82,14 +139,14 @@ void PasswordEntryScreen::draw() {
 
     // Password line
     d.setCursor(4, BLUE_ZONE_Y + 12);
-    d.print("Pass: ");
+    d.print(F("Pass: "));
     d.print(password);
 
     // Separator line above buttons
-    d.drawLine(3, SCREEN_HEIGHT - 18, SCREEN_WIDTH - 3, SCREEN_HEIGHT - 18, SSD1306_WHITE);
+    display->drawHLineFast(3, SCREEN_HEIGHT - 18, SCREEN_WIDTH - 5);
 
     // Buttons at bottom
-    String buttons[] = {"Del", "Save", "Edit", "Exit"};
+    String buttons[] = {F("Del"), F("Save"), F("Edit"), F("Exit")};
     int buttonWidth = 24;
     int buttonCount = 4;
     int totalButtonWidth = buttonCount * buttonWidth;
@@ -101,7 +158,7 @@ void PasswordEntryScreen::draw() {
       int yPos = SCREEN_HEIGHT - 12;
 
       if (i == modalSelection) {
-        d.fillRect(xPos, yPos - 2, buttonWidth, 10, SSD1306_WHITE);
+        display->fillRectFast(xPos, yPos - 2, buttonWidth, 10);
         d.setTextColor(SSD1306_BLACK);
       } else {
         d.setTextColor(SSD1306_WHITE);
@@ -115,11 +172,28 @@ void PasswordEntryScreen::draw() {
     YellowBar::draw(*display, ssid.substring(0, 15));
 
     // Draw password input in blue zone (safely below y=16)
-    TextInputDisplay::draw(*display, "Pass:", password, 20);
+    TextInputDisplay::draw(*display, F("Pass:"), password, 20);
 
-    display->drawText("Select character:", 2, 32, 1);
+    display->drawText(F("Select character:"), 2, 32, 1);
     CharacterSelector::draw(*display, KEYBOARD_CHARS, KEYBOARD_CHARS_COUNT, charIndex, 42);
   }
 
   display->show();
 }
+
+void PasswordEntryScreen::drawConnecting() {
+  YellowBar::draw(*display, F("Connecting"));
+
+  display->drawCenteredText(ssid.substring(0, 20), BLUE_ZONE_Y + 4, 1);
+  ActivityIndicator::draw(*display, SCREEN_WIDTH / 2, BLUE_ZONE_Y + 16);
+  ProgressBar::draw(*display, 14, BLUE_ZONE_Y + 25, SCREEN_WIDTH - 28, 6, wifi->getConnectProgress(), 100);
+  display->drawCenteredText(F("Long press: cancel"), BLUE_ZONE_Y + 37, 1);
+}
+
+void PasswordEntryScreen::drawFailed() {
+  YellowBar::draw(*display, F("Connect failed"));
+
+  Icons::drawError(*display, 7, BLUE_ZONE_Y + 9);
+  display->drawText(wifi->getLastError().message, 18, BLUE_ZONE_Y + 6, 1);
+  display->drawCenteredText(F("Press to edit"), BLUE_ZONE_Y + 28, 1);
+}
@@ -15,6 +15,11 @@ private:
   bool showModal;
   int modalSelection;
   String ssid;  // Store SSID from WiFiScanScreen
+  bool connecting;     // Waiting for WiFiManager to report a result
+  bool connectFailed;  // Showing the failure message
+
+  void drawConnecting();
+  void drawFailed();
 
 public:
   PasswordEntryScreen(DisplayManager* disp, WiFiManager* wifiMgr, SettingsManager* settingsMgr);
@@ -27,6 +32,8 @@ public:
   void handleEncoder(int delta) override;
   void handleShortPress() override;
   void handleLongPress() override;
+  bool needsContinuousRefresh() const override { return connecting; }
+  bool wantsEncoderAcceleration() const override { return !showModal && !connecting; }  // Character picker only
   void draw() override;
 };
 
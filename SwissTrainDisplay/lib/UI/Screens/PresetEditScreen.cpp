@@ -1,8 +1,10 @@
 #include "PresetEditScreen.h"
+#include "../../Data/StationIndex.h"
 
 PresetEditScreen::PresetEditScreen(DisplayManager* disp, PresetManager* presetMgr)
   : Screen(disp), presets(presetMgr), editingIndex(0), fieldIndex(0),
-    editing(false), charIndex(0), showModal(false), modalSelection(0), createMode(false) {
+    editing(false), charIndex(0), showModal(false), modalSelection(0), createMode(false),
+    completionCount(0) {
 }
 
 void PresetEditScreen::setCreateMode(PresetType type) {
@@ -14,13 +16,13 @@ void PresetEditScreen::setCreateMode(PresetType type) {
   // Set default names based on type
   switch (type) {
     case PRESET_CLOCK:
-      editBuffer.name = "Clock";
+      editBuffer.name = F("Clock");
       break;
     case PRESET_WEATHER:
-      editBuffer.name = "Weather";
+      editBuffer.name = F("Weather");
       break;
     case PRESET_CALENDAR:
-      editBuffer.name = "Calendar";
+      editBuffer.name = F("Calendar");
       break;
     case PRESET_TRAIN:
     default:
@@ -38,6 +40,22 @@ int PresetEditScreen::getFieldCount() const {
   }
 }
 
+bool PresetEditScreen::isStationField() const {
+  return editBuffer.type == PRESET_TRAIN && (fieldIndex == 1 || fieldIndex == 2);
+}
+
+void PresetEditScreen::refreshCompletion() {
+  completion = "";
+  completionCount = 0;
+  if (!editing || !isStationField()) return;
+
+  const String& field = (fieldIndex == 1) ? editBuffer.fromStation : editBuffer.toStation;
+  if ((int)field.length() < STATION_COMPLETE_MIN_CHARS) return;
+
+  // Only the first match is shown; the count tells how much more to type
+  StationIndex::complete(field, &completion, 1, &completionCount);
+}
+
 void PresetEditScreen::enter() {
   Serial.println("Entering PresetEditScreen");
   if (!createMode) {
@@ -53,6 +71,8 @@ void PresetEditScreen::enter() {
   fieldIndex = 0;
   editing = false;
   showModal = false;
+  tapCompletion = "";
+  refreshCompletion();
 }
 
 void PresetEditScreen::exit() {}
@@ -66,12 +86,11 @@ void PresetEditScreen::handleEncoder(int delta) {
     if (modalSelection < 0) modalSelection = 2;
     if (modalSelection > 2) modalSelection = 0;
   } else if (editing) {
-    // Character selection
-    bool isStationField = (editBuffer.type == PRESET_TRAIN && (fieldIndex == 1 || fieldIndex == 2));
-    int maxChars = isStationField ? STATION_CHARS_COUNT : KEYBOARD_CHARS_COUNT;
-    charIndex += delta;
-    if (charIndex < 0) charIndex = maxChars - 1;
-    if (charIndex >= maxChars) charIndex = 0;
+    // Character selection; a turn between taps is not a double press on the hint
+    tapCompletion = "";
+    int maxChars = isStationField() ? STATION_CHARS_COUNT : KEYBOARD_CHARS_COUNT;
+    // Modular wrap keeps accelerated steps consistent across the ends
+    charIndex = ((charIndex + delta) % maxChars + maxChars) % maxChars;
   } else {
     // Field selection
     int maxField = getFieldCount() - 1;
@@ -82,6 +101,8 @@ void PresetEditScreen::handleEncoder(int delta) {
 }
 
 void PresetEditScreen::handleShortPress() {
+  tapCompletion = "";
+
   if (showModal) {
     switch (modalSelection) {
       case 0: // Del
@@ -96,23 +117,26 @@ void PresetEditScreen::handleShortPress() {
             editBuffer.toStation.remove(editBuffer.toStation.length() - 1);
           }
         }
+        refreshCompletion();
         break;
       case 1: // Done (close modal and continue editing)
         showModal = false;
         editing = false;
+        refreshCompletion();
         break;
       case 2: // Cancel
         showModal = false;
         break;
     }
   } else if (editing) {
-    // Add character
-    bool isStationField = (editBuffer.type == PRESET_TRAIN && (fieldIndex == 1 || fieldIndex == 2));
-    const char* charset = isStationField ? STATION_CHARS : KEYBOARD_CHARS;
-    char ch = charset[charIndex];
+    // Add character; a double press arrives after this tap was applied,
+    // so remember what it would have accepted
+    tapCompletion = completion;
+    bool stationField = isStationField();
+    char ch = charsetAt(stationField ? STATION_CHARS : KEYBOARD_CHARS, charIndex);
 
     // Auto-capitalize first letter for station names
-    if (isStationField && ch >= 'a' && ch <= 'z') {
+    if (stationField && ch >= 'a' && ch <= 'z') {
       String& field = (fieldIndex == 1) ? editBuffer.fromStation : editBuffer.toStation;
       if (field.length() == 0) ch = ch - 32;
     }
@@ -123,6 +147,7 @@ void PresetEditScreen::handleShortPress() {
       if (fieldIndex == 1) editBuffer.fromStation += ch;
       else if (fieldIndex == 2) editBuffer.toStation += ch;
     }
+    refreshCompletion();
   } else {
     // Enter editing, save, or cancel
     int fieldCount = getFieldCount();
@@ -137,7 +162,7 @@ void PresetEditScreen::handleShortPress() {
       } else {
         presets->updatePreset(editingIndex, editBuffer);
       }
-      presets->saveAll();
+      // Written by the storage task once edits settle
       requestState(STATE_PRESET_SELECT);
     } else if (createMode && fieldIndex == cancelFieldIndex) {
       // Cancel creation
@@ -153,6 +178,7 @@ void PresetEditScreen::handleShortPress() {
       // Enter field editing for name/from/to fields
       editing = true;
       charIndex = 0;
+      refreshCompletion();
     }
   }
 }
@@ -167,35 +193,62 @@ void PresetEditScreen::handleLongPress() {
   }
 }
 
+void PresetEditScreen::handleDoublePress() {
+  if (!editing || showModal || tapCompletion.length() == 0) {
+    handleShortPress();
+    return;
+  }
+
+  // Take the suggestion shown before the first tap, which also drops the
+  // character that tap appended, and return to the field list
+  String& field = (fieldIndex == 1) ? editBuffer.fromStation : editBuffer.toStation;
+  field = tapCompletion;
+  tapCompletion = "";
+  editing = false;
+  refreshCompletion();
+}
+
 void PresetEditScreen::draw() {
   display->clear();
 
   if (showModal) {
-    String fieldName = (fieldIndex == 0) ? "Name" :
-                      (fieldIndex == 1) ? "From" : "To";
+    String fieldName = (fieldIndex == 0) ? F("Name") :
+                      (fieldIndex == 1) ? F("From") : F("To");
     String* field = (fieldIndex == 0) ? &editBuffer.name :
                    (fieldIndex == 1) ? &editBuffer.fromStation : &editBuffer.toStation;
-    String buttons[] = {"Del", "Done", "Cancel"};
-    String title = createMode ? "New Preset" : "Edit " + fieldName;
+    String buttons[] = {F("Del"), F("Done"), F("Cancel")};
+    String title = createMode ? String(F("New Preset")) : String(F("Edit ")) + fieldName;
     ModalDialog::draw(*display, title, *field, buttons, 3, modalSelection);
   } else if (editing) {
     // Character selection mode
-    String title = createMode ? "New Preset" : "Edit Field";
+    String title = createMode ? F("New Preset") : F("Edit Field");
     YellowBar::draw(*display, title);
 
-    String fieldLabel = (fieldIndex == 0) ? "Name:" :
-                       (fieldIndex == 1) ? "From:" : "To:";
+    String fieldLabel = (fieldIndex == 0) ? F("Name:") :
+                       (fieldIndex == 1) ? F("From:") : F("To:");
     String* field = (fieldIndex == 0) ? &editBuffer.name :
                    (fieldIndex == 1) ? &editBuffer.fromStation : &editBuffer.toStation;
     TextInputDisplay::draw(*display, fieldLabel, *field, 18);
 
-    bool isStationField = (editBuffer.type == PRESET_TRAIN && (fieldIndex == 1 || fieldIndex == 2));
-    const char* charset = isStationField ? STATION_CHARS : KEYBOARD_CHARS;
-    int charsetSize = isStationField ? STATION_CHARS_COUNT : KEYBOARD_CHARS_COUNT;
+    if (completion.length() > 0) {
+      // Double press accepts the suggestion
+      String hint = completionCount > 1 ? String(F(" +")) + String(completionCount - 1) : String();
+      String line = String(F("2x ")) + completion;
+      line = line.substring(0, 21 - hint.length()) + hint;
+      Adafruit_SSD1306& d = display->getDisplay();
+      d.setTextSize(1);
+      d.setTextColor(SSD1306_WHITE);
+      d.setCursor(2, 28);
+      d.print(line);
+    }
+
+    bool stationField = isStationField();
+    PGM_P charset = stationField ? STATION_CHARS : KEYBOARD_CHARS;
+    int charsetSize = stationField ? STATION_CHARS_COUNT : KEYBOARD_CHARS_COUNT;
     CharacterSelector::draw(*display, charset, charsetSize, charIndex);
   } else {
     // Field selection mode
-    String title = createMode ? "New Preset" : "Edit Preset";
+    String title = createMode ? F("New Preset") : F("Edit Preset");
     YellowBar::draw(*display, title);
 
     int fieldCount = getFieldCount();
@@ -203,21 +256,21 @@ void PresetEditScreen::draw() {
 
     if (editBuffer.type == PRESET_TRAIN) {
       // Show "(optional)" for empty train preset names
-      String displayName = editBuffer.name.length() > 0 ? editBuffer.name.substring(0, 8) : "(optional)";
-      items[0] = "Name: " + displayName;
-      items[1] = "From: " + editBuffer.fromStation.substring(0, 8);
-      items[2] = "To: " + editBuffer.toStation.substring(0, 8);
-      items[3] = "Trains: " + String(editBuffer.trainsToDisplay);
-      items[4] = "< Save";
+      String displayName = editBuffer.name.length() > 0 ? editBuffer.name.substring(0, 8) : String(F("(optional)"));
+      items[0] = String(F("Name: ")) + displayName;
+      items[1] = String(F("From: ")) + editBuffer.fromStation.substring(0, 8);
+      items[2] = String(F("To: ")) + editBuffer.toStation.substring(0, 8);
+      items[3] = String(F("Trains: ")) + String(editBuffer.trainsToDisplay);
+      items[4] = F("< Save");
       if (createMode) {
-        items[5] = "< Cancel";
+        items[5] = F("< Cancel");
       }
     } else {
       // Clock, Weather, Calendar - just name
-      items[0] = "Name: " + editBuffer.name.substring(0, 8);
-      items[1] = "< Save";
+      items[0] = String(F("Name: ")) + editBuffer.name.substring(0, 8);
+      items[1] = F("< Save");
       if (createMode) {
-        items[2] = "< Cancel";
+        items[2] = F("< Cancel");
       }
     }
 
@@ -16,8 +16,13 @@ private:
   int modalSelection;
   Preset editBuffer;
   bool createMode;  // True when creating new preset, false when editing existing
+  String completion;    // First station matching the typed prefix ("" = none)
+  int completionCount;  // Stations matching altogether
+  String tapCompletion; // Suggestion shown before the last character tap
 
   int getFieldCount() const;  // Get number of editable fields based on preset type
+  bool isStationField() const;
+  void refreshCompletion();   // Look up the typed station prefix in the flash index
 
 public:
   PresetEditScreen(DisplayManager* disp, PresetManager* presetMgr);
@@ -31,6 +36,8 @@ public:
   void handleEncoder(int delta) override;
   void handleShortPress() override;
   void handleLongPress() override;
+  void handleDoublePress() override;  // Accepts the suggested station
+  bool wantsEncoderAcceleration() const override { return editing && !showModal; }  // Character picker only
   void draw() override;
 };
 
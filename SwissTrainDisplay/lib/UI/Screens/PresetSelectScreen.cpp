@@ -17,7 +17,21 @@ void PresetSelectScreen::enter() {
 }
 
 void PresetSelectScreen::exit() {}
-void PresetSelectScreen::update() {}
+
+void PresetSelectScreen::update() {
+  // Scroll the selected name; the render task repaints and flushes only its row
+  if (mode == MODE_LIST && selectedMarquee.tick()) {
+    invalidateRegion(menuList.getSelectedRowY(BLUE_ZONE_Y + 2), MENU_ITEM_HEIGHT);
+  }
+}
+
+void PresetSelectScreen::drawRegion() {
+  if (mode != MODE_LIST) {
+    return;
+  }
+  menuList.setSelectedTextOffset(selectedMarquee.getOffset());
+  menuList.redrawSelected(*display, selectedMarquee.getText(), getTotalMenuItems(), BLUE_ZONE_Y + 2);
+}
 
 int PresetSelectScreen::getTotalMenuItems() const {
   // Presets + "Add New" + "< Back"
@@ -29,12 +43,11 @@ void PresetSelectScreen::handleEncoder(int delta) {
 
   switch (mode) {
     case MODE_LIST:
-      selection += delta;
       {
         int totalItems = getTotalMenuItems();
-        if (selection < 0) selection = totalItems - 1;
-        if (selection >= totalItems) selection = 0;
+        selection = ((selection + delta) % totalItems + totalItems) % totalItems;
         menuList.setSelected(selection);
+        selectedMarquee.reset();  // Hold until the new row is drawn
       }
       break;
 
@@ -118,34 +131,44 @@ void PresetSelectScreen::draw() {
   }
 }
 
+String PresetSelectScreen::getListItem(int index, bool full) const {
+  // The list only needs the resident index, not the full presets
+  const PresetSummary* p = presets->getSummary(index);
+  if (!p) {
+    return "";
+  }
+
+  String checkbox = p->enabled ? "[x]" : "[ ]";
+  String prefix = (index == presets->getCurrentIndex()) ? ">" : " ";
+  String name = p->label;
+
+  // Truncate unselected names to max 15 chars to prevent wrapping;
+  // the selected one scrolls as a marquee instead
+  if (!full && name.length() > 15) {
+    name = name.substring(0, 15);
+  }
+  return checkbox + prefix + name;
+}
+
 void PresetSelectScreen::drawList() {
   display->clear();
-  YellowBar::draw(*display, "Manage Presets");
+  YellowBar::draw(*display, F("Manage Presets"));
 
-  Adafruit_SSD1306& d = display->getDisplay();
   int count = presets->getCount();
   int totalItems = getTotalMenuItems();
   String items[totalItems];
 
   // Build preset list with checkboxes on left
   for (int i = 0; i < count; i++) {
-    const Preset* p = presets->getPreset(i);
-    if (p) {
-      String checkbox = p->enabled ? "[x]" : "[ ]";
-      String prefix = (i == presets->getCurrentIndex()) ? ">" : " ";
-      // Truncate name to max 15 chars to prevent wrapping
-      String name = PresetManager::getDisplayName(*p);
-      if (name.length() > 15) {
-        name = name.substring(0, 15);
-      }
-      items[i] = checkbox + prefix + name;
-    }
+    items[i] = getListItem(i, i == selection);
   }
 
   // Add bottom menu items
-  items[count] = "Add New";
-  items[count + 1] = "< Back";
+  items[count] = F("Add New");
+  items[count + 1] = F("< Back");
 
+  selectedMarquee.setText(*display, items[selection], MenuList::selectedTextWidth(totalItems));
+  menuList.setSelectedTextOffset(selectedMarquee.getOffset());
   menuList.draw(*display, items, totalItems, BLUE_ZONE_Y + 2);
   display->show();
 }
@@ -153,21 +176,21 @@ void PresetSelectScreen::drawList() {
 void PresetSelectScreen::drawActionMenu() {
   display->clear();
 
-  const Preset* p = presets->getPreset(selection);
+  const PresetSummary* p = presets->getSummary(selection);
   if (!p) {
     mode = MODE_LIST;
     return;
   }
 
   // Truncate preset name for title
-  String title = PresetManager::getDisplayName(*p);
+  String title = p->label;
   if (title.length() > 13) {
     title = title.substring(0, 13);
   }
   YellowBar::draw(*display, title);
 
-  String toggleText = p->enabled ? "Disable" : "Enable";
-  String items[] = {"Edit", "Delete", toggleText, "< Cancel"};
+  String toggleText = p->enabled ? F("Disable") : F("Enable");
+  String items[] = {F("Edit"), F("Delete"), toggleText, F("< Cancel")};
 
   MenuList list;
   list.setSelected(actionSelection);
@@ -178,9 +201,9 @@ void PresetSelectScreen::drawActionMenu() {
 
 void PresetSelectScreen::drawTypeSelect() {
   display->clear();
-  YellowBar::draw(*display, "Add Preset");
+  YellowBar::draw(*display, F("Add Preset"));
 
-  String items[] = {"Train Route", "Clock", "Weather", "Calendar", "< Cancel"};
+  String items[] = {F("Train Route"), F("Clock"), F("Weather"), F("Calendar"), F("< Cancel")};
   MenuList list;
   list.setSelected(typeSelection);
   list.draw(*display, items, 5, BLUE_ZONE_Y + 2);
@@ -191,16 +214,16 @@ void PresetSelectScreen::drawTypeSelect() {
 void PresetSelectScreen::drawDeleteConfirm() {
   display->clear();
 
-  const Preset* p = presets->getPreset(presetToDelete);
+  const PresetSummary* p = presets->getSummary(presetToDelete);
   if (!p) {
     mode = MODE_LIST;
     return;
   }
 
-  String content = "Delete '" + PresetManager::getDisplayName(*p) + "'?";
-  String buttons[] = {"Cancel", "Confirm"};
+  String content = String(F("Delete '")) + p->label + "'?";
+  String buttons[] = {F("Cancel"), F("Confirm")};
 
-  ModalDialog::draw(*display, "Confirm Delete", content, buttons, 2, deleteConfirmSelection);
+  ModalDialog::draw(*display, F("Confirm Delete"), content, buttons, 2, deleteConfirmSelection);
   display->show();
 }
 
@@ -231,8 +254,7 @@ void PresetSelectScreen::handleActionSelection() {
       {
         Preset updatedPreset = *p;
         updatedPreset.enabled = !updatedPreset.enabled;
-        presets->updatePreset(selection, updatedPreset);
-        presets->saveAll();
+        presets->updatePreset(selection, updatedPreset);  // Flushed by the storage task
         mode = MODE_LIST;
       }
       break;
@@ -280,8 +302,7 @@ void PresetSelectScreen::handleDeleteConfirm() {
         presets->setCurrentIndex(newCurrent);
       }
 
-      presets->deletePreset(presetToDelete);
-      presets->saveAll();
+      presets->deletePreset(presetToDelete);  // Flushed by the storage task
 
       // Adjust selection if needed
       if (selection >= presets->getCount()) {
@@ -16,6 +16,7 @@ class PresetSelectScreen : public Screen {
 private:
   PresetManager* presets;
   MenuList menuList;
+  Marquee selectedMarquee;  // Scrolls the selected preset name
   int selection;
   PresetScreenMode mode;
   int actionSelection;
@@ -25,6 +26,7 @@ private:
   PresetType newPresetType;
 
   int getTotalMenuItems() const;
+  String getListItem(int index, bool full) const;
   void drawList();
   void drawActionMenu();
   void drawTypeSelect();
@@ -42,7 +44,9 @@ public:
   void handleEncoder(int delta) override;
   void handleShortPress() override;
   void handleLongPress() override;
+  bool wantsEncoderAcceleration() const override { return mode == MODE_LIST; }  // Long preset list
   void draw() override;
+  void drawRegion() override;  // Selected row marquee step
 
   // Getters for state machine transitions
   int getSelectedPreset() const { return selection; }
@@ -1,5 +1,6 @@
 #include "Screen.h"
 
 Screen::Screen(DisplayManager* disp)
-  : display(disp), nextState(STATE_MAIN_DISPLAY), requestStateChange(false), needsRedraw(false) {
+  : display(disp), nextState(STATE_MAIN_DISPLAY), requestStateChange(false), needsRedraw(false),
+    dirtyY(0), dirtyHeight(0) {
 }
@@ -20,6 +20,8 @@ protected:
   AppState nextState;  // State to transition to (if any)
   bool requestStateChange;
   bool needsRedraw;    // Flag to request redraw
+  int dirtyY;          // Band repainted by drawRegion() (dirtyHeight 0 = none)
+  int dirtyHeight;
 
 public:
   Screen(DisplayManager* disp);
@@ -35,9 +37,22 @@ public:
   virtual void handleShortPress() = 0;
   virtual void handleLongPress() = 0;
 
+  // Double press - screens without a use for it see a second short press
+  virtual void handleDoublePress() { handleShortPress(); }
+
+  // Power: screens that animate or tick (clock, progress) keep the device awake
+  virtual bool needsContinuousRefresh() const { return false; }
+
+  // Encoder acceleration opt-in (long lists, character pickers)
+  virtual bool wantsEncoderAcceleration() const { return false; }
+
   // Drawing
   virtual void draw() = 0;
 
+  // Partial redraw (marquee steps): repaint the band passed to
+  // invalidateRegion() into the buffer; the render task flushes it
+  virtual void drawRegion() {}
+
   // State management
   bool hasStateChangeRequest() const { return requestStateChange; }
   AppState getNextState() const { return nextState; }
@@ -46,6 +61,10 @@ public:
   // Redraw management
   bool needsRedrawNow() const { return needsRedraw; }
   void clearRedrawFlag() { needsRedraw = false; }
+  bool hasDirtyRegion() const { return dirtyHeight > 0; }
+  int getDirtyY() const { return dirtyY; }
+  int getDirtyHeight() const { return dirtyHeight; }
+  void clearDirtyRegion() { dirtyHeight = 0; }
 
 protected:
   void requestState(AppState state) {
@@ -56,6 +75,18 @@ protected:
   void requestRedraw() {
     needsRedraw = true;
   }
+
+  void invalidateRegion(int y, int h) {
+    // Grow the pending band to cover both
+    if (dirtyHeight > 0) {
+      int bottom = max(dirtyY + dirtyHeight, y + h);
+      dirtyY = min(dirtyY, y);
+      dirtyHeight = bottom - dirtyY;
+    } else {
+      dirtyY = y;
+      dirtyHeight = h;
+    }
+  }
 };
 
 #endif // SCREEN_H
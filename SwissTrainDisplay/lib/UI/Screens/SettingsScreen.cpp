@@ -2,8 +2,9 @@
 
 SettingsScreen::SettingsScreen(DisplayManager* disp)
   : Screen(disp), selection(0) {
-  menuItems[0] = "WiFi Setup";
-  menuItems[1] = "< Back";
+  menuItems[0] = F("WiFi Setup");
+  menuItems[1] = F("Storage");
+  menuItems[2] = F("< Back");
 }
 
 void SettingsScreen::enter() {
@@ -26,6 +27,8 @@ void SettingsScreen::handleEncoder(int delta) {
 void SettingsScreen::handleShortPress() {
   if (selection == SETTINGS_WIFI) {
     requestState(STATE_WIFI_SCAN);
+  } else if (selection == SETTINGS_DISPLAY) {
+    requestState(STATE_STORAGE_INFO);
   } else {
     requestState(STATE_MENU);
   }
@@ -37,7 +40,7 @@ void SettingsScreen::handleLongPress() {
 
 void SettingsScreen::draw() {
   display->clear();
-  YellowBar::drawWithTime(*display, "SETTINGS");
+  YellowBar::drawWithTime(*display, F("SETTINGS"));
   menuList.draw(*display, menuItems, MENU_ITEM_COUNT, BLUE_ZONE_Y + 2);
   display->show();
 }
@@ -8,7 +8,7 @@ class SettingsScreen : public Screen {
 private:
   MenuList menuList;
   int selection;
-  static const int MENU_ITEM_COUNT = 2;
+  static const int MENU_ITEM_COUNT = 3;
   String menuItems[MENU_ITEM_COUNT];
 
 public:
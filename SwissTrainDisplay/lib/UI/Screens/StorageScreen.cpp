@@ -0,0 +1,81 @@
+#include "StorageScreen.h"
+
+static String formatKB(size_t bytes) {
+  return String(bytes / 1024.0f, 1) + "K";
+}
+
+StorageScreen::StorageScreen(DisplayManager* disp, SettingsManager* settingsMgr)
+  : Screen(disp), settings(settingsMgr), available(false), page(0), refreshedAt(0) {
+}
+
+void StorageScreen::enter() {
+  Serial.println("Entering StorageScreen");
+  page = 0;
+  refresh();
+}
+
+void StorageScreen::exit() {}
+
+void StorageScreen::update() {
+  // Counters move while presets save in the background
+  if (millis() - refreshedAt >= STORAGE_SCREEN_REFRESH_MS) {
+    refresh();
+    requestRedraw();
+  }
+}
+
+void StorageScreen::refresh() {
+  available = settings && settings->getTelemetry(telemetry);
+  refreshedAt = millis();
+}
+
+void StorageScreen::handleEncoder(int delta) {
+  if (delta != 0) {
+    page = (page + (delta > 0 ? 1 : PAGE_COUNT - 1)) % PAGE_COUNT;
+  }
+}
+
+void StorageScreen::handleShortPress() {
+  requestState(STATE_SETTINGS);
+}
+
+void StorageScreen::handleLongPress() {
+  requestState(STATE_SETTINGS);
+}
+
+void StorageScreen::draw() {
+  display->clear();
+  YellowBar::draw(*display, "STORAGE " + String(page + 1) + "/" + String(PAGE_COUNT));
+
+  if (!available) {
+    display->drawText(F("Storage unavailable"), 4, 28, 1);
+  } else if (page == 0) {
+    drawUsage();
+  } else {
+    drawWrites();
+  }
+
+  display->show();
+}
+
+void StorageScreen::drawUsage() {
+  int percent = telemetry.totalBytes > 0 ? (int)(telemetry.usedBytes * 100 / telemetry.totalBytes) : 0;
+  display->drawText("Used " + formatKB(telemetry.usedBytes) + "/" + formatKB(telemetry.totalBytes) +
+                    " " + String(percent) + "%", 2, 18, 1);
+  ProgressBar::draw(*display, 2, 28, SCREEN_WIDTH - 4, 6, telemetry.usedBytes,
+                    telemetry.totalBytes > 0 ? telemetry.totalBytes : 1);
+
+  display->drawText("Free " + formatKB(telemetry.freeBytes()) + " Jnl " + formatKB(telemetry.journalBytes), 2, 37, 1);
+  display->drawText("Writes " + String(telemetry.lifetime.totalWrites()) + " (" +
+                    String(telemetry.boot.totalWrites()) + " boot)", 2, 46, 1);
+  display->drawText("Wear ~" + String(telemetry.erasesPerBlock(), 1) + " erase/blk", 2, 55, 1);
+}
+
+void StorageScreen::drawWrites() {
+  char line[24];
+  for (int i = 0; i < STORAGE_CLASS_COUNT; i++) {
+    snprintf(line, sizeof(line), "%-9s%6lu%6lu", StorageTelemetry::className(i),
+             (unsigned long)telemetry.lifetime.writes[i], (unsigned long)telemetry.boot.writes[i]);
+    display->drawText(line, 1, 17 + i * 8, 1);
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef STORAGESCREEN_H
+#define STORAGESCREEN_H
+
+#include "Screen.h"
+#include "../UIComponents.h"
+#include "../../Storage/SettingsManager.h"
+
+// ====== STORAGE DIAGNOSTICS ======
+// Page 1: LittleFS usage, journal size and estimated wear
+// Page 2: writes per key class (lifetime / this boot)
+
+class StorageScreen : public Screen {
+private:
+  SettingsManager* settings;
+  StorageTelemetry telemetry;
+  bool available;
+  int page;
+  unsigned long refreshedAt;
+
+  static const int PAGE_COUNT = 2;
+
+  void refresh();
+  void drawUsage();
+  void drawWrites();
+
+public:
+  StorageScreen(DisplayManager* disp, SettingsManager* settingsMgr);
+
+  void enter() override;
+  void exit() override;
+  void update() override;
+  void handleEncoder(int delta) override;
+  void handleShortPress() override;
+  void handleLongPress() override;
+  void draw() override;
+};
+
+#endif // STORAGESCREEN_H
@@ -6,29 +6,31 @@ WiFiScanScreen::WiFiScanScreen(DisplayManager* disp, WiFiManager* wifiMgr, Setti
 
 void WiFiScanScreen::enter() {
   Serial.println("Entering WiFiScanScreen");
-  selection = 0;
-  scanning = true;
+  performScan();
+}
 
-  // Show "Scanning..." immediately
-  draw();
+void WiFiScanScreen::exit() {}
 
-  // Perform scan
-  wifi->scan();
-  scanning = false;
+void WiFiScanScreen::update() {
+  if (!scanning) {
+    return;
+  }
 
-  menuList.setSelected(0);
-  requestRedraw();
+  // StateMachine polls the scan; show the list as soon as it lands
+  if (!wifi->isScanning()) {
+    scanning = false;
+    selection = 0;
+    menuList.setSelected(0);
+    requestRedraw();
+  } else if (ActivityIndicator::frameChanged()) {
+    requestRedraw();
+  }
 }
 
-void WiFiScanScreen::exit() {}
-void WiFiScanScreen::update() {}
-
 void WiFiScanScreen::handleEncoder(int delta) {
   if (delta != 0 && !scanning) {
-    selection += delta;
     int totalItems = getTotalMenuItems();
-    if (selection < 0) selection = totalItems - 1;
-    if (selection >= totalItems) selection = 0;
+    selection = ((selection + delta) % totalItems + totalItems) % totalItems;
     menuList.setSelected(selection);
   }
 }
@@ -59,31 +61,29 @@ void WiFiScanScreen::handleShortPress() {
 
 void WiFiScanScreen::performScan() {
   selection = 0;
-  scanning = true;
-  draw();
-
-  wifi->scan();
-  scanning = false;
-
   menuList.setSelected(0);
+  scanning = wifi->startScan();
   requestRedraw();
 }
 
 void WiFiScanScreen::handleLongPress() {
+  // A running scan finishes in the background and is kept for next time
   requestState(STATE_SETTINGS);
 }
 
 void WiFiScanScreen::draw() {
   display->clear();
-  YellowBar::draw(*display, "WiFi Networks");
+  YellowBar::draw(*display, F("WiFi Networks"));
 
   if (scanning) {
-    display->drawCenteredText("Scanning...", 30, 1);
+    display->drawCenteredText(F("Scanning..."), 24, 1);
+    ActivityIndicator::draw(*display, SCREEN_WIDTH / 2, 36);
+    ProgressBar::draw(*display, 14, 46, SCREEN_WIDTH - 28, 6, wifi->getScanProgress(), 100);
   } else if (wifi->getNetworkCount() == 0) {
-    display->drawCenteredText("No networks found", 30, 1);
+    display->drawCenteredText(F("No networks found"), 30, 1);
 
     // Show bottom menu options even when no networks
-    String bottomItems[] = {"Refresh", "< Back"};
+    String bottomItems[] = {F("Refresh"), F("< Back")};
     menuList.draw(*display, bottomItems, 2, BLUE_ZONE_Y + 2);
   } else {
     // Show networks + bottom menu options
@@ -97,8 +97,8 @@ void WiFiScanScreen::draw() {
     }
 
     // Add bottom menu options
-    items[networks.size()] = "Refresh";
-    items[networks.size() + 1] = "< Back";
+    items[networks.size()] = F("Refresh");
+    items[networks.size() + 1] = F("< Back");
 
     menuList.draw(*display, items, totalItems, BLUE_ZONE_Y + 2);
   }
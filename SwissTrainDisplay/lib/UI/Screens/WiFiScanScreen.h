@@ -26,6 +26,8 @@ public:
   void handleEncoder(int delta) override;
   void handleShortPress() override;
   void handleLongPress() override;
+  bool needsContinuousRefresh() const override { return scanning; }
+  bool wantsEncoderAcceleration() const override { return true; }  // Network list
   void draw() override;
 
   // Getters
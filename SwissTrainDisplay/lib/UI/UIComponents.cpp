@@ -1,13 +1,72 @@
 #include "UIComponents.h"
 #include <time.h>
 
+// ====== MARQUEE ======
+
+Marquee::Marquee() : text(""), textWidth(0), viewWidth(0), offset(0), lastStep(0) {
+}
+
+void Marquee::setText(DisplayManager& disp, const String& newText, int visibleWidth) {
+  if (newText == text && visibleWidth == viewWidth) {
+    return;
+  }
+
+  text = newText;
+  textWidth = disp.getTextWidth(text, 1);
+  viewWidth = visibleWidth;
+  reset();
+}
+
+void Marquee::reset() {
+  offset = 0;
+  lastStep = millis();
+}
+
+bool Marquee::tick() {
+  if (!isScrolling()) {
+    return false;
+  }
+
+  unsigned long now = millis();
+
+  // Hold at the start of each loop so the beginning is readable
+  unsigned long interval = (offset == 0) ? MARQUEE_PAUSE_MS : MARQUEE_STEP_MS;
+  if (now - lastStep < interval) {
+    return false;
+  }
+  lastStep = now;
+
+  offset += MARQUEE_STEP_PX;
+  if (offset >= textWidth + MARQUEE_GAP_PX) {
+    offset = 0;
+  }
+  return true;
+}
+
+void Marquee::draw(DisplayManager& disp, int x, int y) {
+  Adafruit_SSD1306& d = disp.getDisplay();
+
+  d.setTextSize(1);
+  d.setTextWrap(false);
+  d.setCursor(x - offset, y);
+  d.print(text);
+
+  // Second copy scrolls in behind the first
+  int repeatX = x - offset + textWidth + MARQUEE_GAP_PX;
+  if (isScrolling() && repeatX < x + viewWidth) {
+    d.setCursor(repeatX, y);
+    d.print(text);
+  }
+  d.setTextWrap(true);
+}
+
 // ====== YELLOW BAR ======
 
 void YellowBar::draw(DisplayManager& disp, const String& title, bool showWiFi, bool wifiConnected) {
   Adafruit_SSD1306& d = disp.getDisplay();
 
   // Fill yellow zone with white (inverted for visibility)
-  d.fillRect(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT, SSD1306_WHITE);
+  disp.fillRectFast(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT);
 
   // Draw title
   d.setTextSize(1);
@@ -21,11 +80,29 @@ void YellowBar::draw(DisplayManager& disp, const String& title, bool showWiFi, b
   }
 }
 
+void YellowBar::draw(DisplayManager& disp, Marquee& title, bool showWiFi, bool wifiConnected) {
+  Adafruit_SSD1306& d = disp.getDisplay();
+
+  disp.fillRectFast(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT);
+
+  d.setTextColor(SSD1306_BLACK);
+  title.draw(disp, TITLE_BAR_PADDING, TITLE_BAR_PADDING);
+
+  // Mask text that scrolled outside the title area
+  int right = TITLE_BAR_PADDING + titleWidth(showWiFi);
+  disp.fillRectFast(0, 0, TITLE_BAR_PADDING, YELLOW_ZONE_HEIGHT);
+  disp.fillRectFast(right, 0, SCREEN_WIDTH - right, YELLOW_ZONE_HEIGHT);
+
+  if (showWiFi) {
+    Icons::drawWiFi(disp, 120, 8, wifiConnected);
+  }
+}
+
 void YellowBar::drawWithTime(DisplayManager& disp, const String& title) {
   Adafruit_SSD1306& d = disp.getDisplay();
 
   // Fill yellow zone
-  d.fillRect(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT, SSD1306_WHITE);
+  disp.fillRectFast(0, 0, SCREEN_WIDTH, YELLOW_ZONE_HEIGHT);
 
   // Draw title on left
   d.setTextSize(1);
@@ -39,10 +116,7 @@ void YellowBar::drawWithTime(DisplayManager& disp, const String& title) {
     char timeStr[6];
     strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
 
-    int16_t x1, y1;
-    uint16_t w, h;
-    d.getTextBounds(timeStr, 0, 0, &x1, &y1, &w, &h);
-    int x = SCREEN_WIDTH - w - TITLE_BAR_PADDING;
+    int x = SCREEN_WIDTH - disp.getTextWidth(timeStr, 1) - TITLE_BAR_PADDING;
 
     d.setCursor(x, TITLE_BAR_PADDING);
     d.print(timeStr);
@@ -51,12 +125,10 @@ void YellowBar::drawWithTime(DisplayManager& disp, const String& title) {
 
 // ====== MENU LIST ======
 
-MenuList::MenuList() : selectedIndex(0), scrollOffset(0) {
+MenuList::MenuList() : selectedIndex(0), scrollOffset(0), selectedTextOffset(0) {
 }
 
 void MenuList::draw(DisplayManager& disp, const String items[], int itemCount, int yStart) {
-  Adafruit_SSD1306& d = disp.getDisplay();
-
   updateScroll(itemCount);
 
   int visibleCount = min(itemCount - scrollOffset, MAX_VISIBLE_MENU_ITEMS);
@@ -65,28 +137,50 @@ void MenuList::draw(DisplayManager& disp, const String items[], int itemCount, i
     int itemIndex = i + scrollOffset;
     int yPos = yStart + (i * MENU_ITEM_HEIGHT);
 
-    bool isSelected = (itemIndex == selectedIndex);
+    drawRow(disp, items[itemIndex], yPos, itemIndex == selectedIndex);
+  }
+
+  drawScrollBar(disp, itemCount, yStart);
+}
 
-    if (isSelected) {
-      // Highlight selected item
-      d.fillRect(0, yPos, SCREEN_WIDTH, MENU_ITEM_HEIGHT, SSD1306_WHITE);
-      d.setTextColor(SSD1306_BLACK);
-      d.setCursor(4, yPos + 1);
-      d.print(">");
-    } else {
-      d.setTextColor(SSD1306_WHITE);
-    }
+void MenuList::redrawSelected(DisplayManager& disp, const String& text, int itemCount, int yStart) {
+  drawRow(disp, text, getSelectedRowY(yStart), true);
+  drawScrollBar(disp, itemCount, yStart);
+}
 
-    d.setCursor(isSelected ? 12 : 8, yPos + 1);
-    d.print(items[itemIndex]);
+void MenuList::drawRow(DisplayManager& disp, const String& text, int yPos, bool isSelected) {
+  Adafruit_SSD1306& d = disp.getDisplay();
+
+  if (!isSelected) {
+    d.setTextColor(SSD1306_WHITE);
+    d.setCursor(8, yPos + 1);
+    d.print(text);
+    return;
   }
 
+  // Highlight selected item
+  disp.fillRectFast(0, yPos, SCREEN_WIDTH, MENU_ITEM_HEIGHT);
+  d.setTextColor(SSD1306_BLACK);
+
+  // Selected text may be a marquee wider than the row - never wrap it
+  d.setTextWrap(false);
+  d.setCursor(12 - selectedTextOffset, yPos + 1);
+  d.print(text);
+  d.setTextWrap(true);
+
+  // Gutter marker (also masks text that scrolled past it)
+  disp.fillRectFast(0, yPos, 12, MENU_ITEM_HEIGHT);
+  d.setCursor(4, yPos + 1);
+  d.print(">");
+}
+
+void MenuList::drawScrollBar(DisplayManager& disp, int itemCount, int yStart) {
   // Draw scroll indicator if needed
   if (itemCount > MAX_VISIBLE_MENU_ITEMS) {
     int scrollBarHeight = (MAX_VISIBLE_MENU_ITEMS * MENU_ITEM_HEIGHT * MAX_VISIBLE_MENU_ITEMS) / itemCount;
     int scrollBarY = yStart + ((selectedIndex * (MAX_VISIBLE_MENU_ITEMS * MENU_ITEM_HEIGHT - scrollBarHeight)) / (itemCount - 1));
 
-    d.fillRect(126, scrollBarY, 2, scrollBarHeight, SSD1306_WHITE);
+    disp.fillRectFast(126, scrollBarY, 2, scrollBarHeight);
   }
 }
 
@@ -114,7 +208,7 @@ void MenuList::updateScroll(int itemCount, int maxVisible) {
 
 // ====== CHARACTER SELECTOR ======
 
-void CharacterSelector::draw(DisplayManager& disp, const char* charset, int charsetSize,
+void CharacterSelector::draw(DisplayManager& disp, PGM_P charset, int charsetSize,
                               int currentIndex, int yPos) {
   Adafruit_SSD1306& d = disp.getDisplay();
 
@@ -128,14 +222,14 @@ void CharacterSelector::draw(DisplayManager& disp, const char* charset, int char
 
     if (positions[i] == 0) {
       // Current character - highlighted
-      d.fillRect(xPositions[i] - 8, yPos, 20, 18, SSD1306_WHITE);
+      disp.fillRectFast(xPositions[i] - 8, yPos, 20, 18);
       d.setTextColor(SSD1306_BLACK);
     } else {
       d.setTextColor(SSD1306_WHITE);
     }
 
     d.setCursor(xPositions[i] - 4, yPos + 2);
-    d.print(charset[idx]);
+    d.print(charsetAt(charset, idx));
   }
 }
 
@@ -146,10 +240,10 @@ void ModalDialog::draw(DisplayManager& disp, const String& title, const String&
   Adafruit_SSD1306& d = disp.getDisplay();
 
   // Background
-  d.fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, SSD1306_BLACK);
+  disp.fillRectFast(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, false);
 
   // Border - full screen with 1px margin
-  d.drawRect(1, 1, SCREEN_WIDTH - 2, SCREEN_HEIGHT - 2, SSD1306_WHITE);
+  disp.drawRectFast(1, 1, SCREEN_WIDTH - 2, SCREEN_HEIGHT - 2);
 
   // Title
   d.setTextSize(1);
@@ -162,7 +256,7 @@ void ModalDialog::draw(DisplayManager& disp, const String& title, const String&
   d.print(content);
 
   // Separator line
-  d.drawLine(3, SCREEN_HEIGHT - 18, SCREEN_WIDTH - 3, SCREEN_HEIGHT - 18, SSD1306_WHITE);
+  disp.drawHLineFast(3, SCREEN_HEIGHT - 18, SCREEN_WIDTH - 5);
 
   // Buttons - fit within border
   int buttonWidth = (buttonCount <= 2) ? 40 : 24;
@@ -175,7 +269,7 @@ void ModalDialog::draw(DisplayManager& disp, const String& title, const String&
     int yPos = SCREEN_HEIGHT - 12;
 
     if (i == selectedButton) {
-      d.fillRect(xPos, yPos - 2, buttonWidth, 10, SSD1306_WHITE);
+      disp.fillRectFast(xPos, yPos - 2, buttonWidth, 10);
       d.setTextColor(SSD1306_BLACK);
     } else {
       d.setTextColor(SSD1306_WHITE);
@@ -188,7 +282,7 @@ void ModalDialog::draw(DisplayManager& disp, const String& title, const String&
 
 void ModalDialog::drawConfirm(DisplayManager& disp, const String& title, const String& content,
                                int selectedOption) {
-  const String buttons[] = {"Cancel", "OK"};
+  const String buttons[] = {F("Cancel"), F("OK")};
   draw(disp, title, content, buttons, 2, selectedOption);
 }
 
@@ -196,16 +290,40 @@ void ModalDialog::drawConfirm(DisplayManager& disp, const String& title, const S
 
 void ProgressBar::draw(DisplayManager& disp, int x, int y, int width, int height,
                        int progress, int total) {
-  Adafruit_SSD1306& d = disp.getDisplay();
-
-  d.drawRect(x, y, width, height, SSD1306_WHITE);
+  disp.drawRectFast(x, y, width, height);
 
   int fillWidth = (progress * (width - 2)) / total;
   if (fillWidth > 0) {
-    d.fillRect(x + 1, y + 1, fillWidth, height - 2, SSD1306_WHITE);
+    disp.fillRectFast(x + 1, y + 1, fillWidth, height - 2);
   }
 }
 
+// ====== ACTIVITY INDICATOR ======
+
+static const unsigned long ACTIVITY_STEP_MS = 250;
+
+void ActivityIndicator::draw(DisplayManager& disp, int centerX, int y) {
+  int phase = (millis() / ACTIVITY_STEP_MS) % 3;
+  for (int i = 0; i < 3; i++) {
+    int x = centerX - 9 + i * 7;
+    if (i == phase) {
+      disp.fillRectFast(x, y, 4, 4);
+    } else {
+      disp.drawRectFast(x, y, 4, 4);
+    }
+  }
+}
+
+bool ActivityIndicator::frameChanged() {
+  static unsigned long lastStep = 0;
+  unsigned long step = millis() / ACTIVITY_STEP_MS;
+  if (step == lastStep) {
+    return false;
+  }
+  lastStep = step;
+  return true;
+}
+
 // ====== TEXT INPUT DISPLAY ======
 
 void TextInputDisplay::draw(DisplayManager& disp, const String& label, const String& text,
@@ -229,44 +347,31 @@ void TextInputDisplay::draw(DisplayManager& disp, const String& label, const Str
 }
 
 // ====== ICONS ======
+// Pre-rasterized column bitmaps (LSB = top row), same pixels as the
+// former line/circle drawing, blitted with DisplayManager::drawBitmapFast
 
-void Icons::drawWiFi(DisplayManager& disp, int x, int y, bool connected) {
-  Adafruit_SSD1306& d = disp.getDisplay();
+static const uint16_t ICON_WIFI_ON[] PROGMEM = {0x01C, 0x03E, 0x07F, 0x07F, 0x07F, 0x03E, 0x01C};
+static const uint16_t ICON_WIFI_OFF[] PROGMEM = {0x01C, 0x022, 0x041, 0x041, 0x041, 0x022, 0x01C};
+static const uint16_t ICON_ERROR[] PROGMEM = {0x041, 0x022, 0x014, 0x008, 0x014, 0x022, 0x041};
+static const uint16_t ICON_WARNING[] PROGMEM = {0x100, 0x1C0, 0x130, 0x10C, 0x117, 0x10C, 0x130, 0x1C0, 0x100};
+static const uint16_t ICON_CHECK[] PROGMEM = {0x004, 0x008, 0x010, 0x008, 0x004, 0x002, 0x001};
 
-  if (connected) {
-    // Draw WiFi waves (simple filled circle for now)
-    d.fillCircle(x, y, 3, SSD1306_BLACK);
-  } else {
-    // Draw X or empty
-    d.drawCircle(x, y, 3, SSD1306_BLACK);
-  }
+void Icons::drawWiFi(DisplayManager& disp, int x, int y, bool connected) {
+  // Filled circle when connected, outline when not (drawn black on the yellow bar)
+  disp.drawBitmapFast(x - 3, y - 3, connected ? ICON_WIFI_ON : ICON_WIFI_OFF, 7, 7, false);
 }
 
 void Icons::drawError(DisplayManager& disp, int x, int y) {
-  Adafruit_SSD1306& d = disp.getDisplay();
-
-  // Draw X
-  d.drawLine(x - 3, y - 3, x + 3, y + 3, SSD1306_WHITE);
-  d.drawLine(x + 3, y - 3, x - 3, y + 3, SSD1306_WHITE);
+  // X
+  disp.drawBitmapFast(x - 3, y - 3, ICON_ERROR, 7, 7);
 }
 
 void Icons::drawWarning(DisplayManager& disp, int x, int y) {
-  Adafruit_SSD1306& d = disp.getDisplay();
-
-  // Draw triangle
-  d.drawLine(x, y - 4, x - 4, y + 4, SSD1306_WHITE);
-  d.drawLine(x, y - 4, x + 4, y + 4, SSD1306_WHITE);
-  d.drawLine(x - 4, y + 4, x + 4, y + 4, SSD1306_WHITE);
-
-  // Draw exclamation mark
-  d.drawPixel(x, y, SSD1306_WHITE);
-  d.drawPixel(x, y - 2, SSD1306_WHITE);
+  // Triangle with exclamation mark
+  disp.drawBitmapFast(x - 4, y - 4, ICON_WARNING, 9, 9);
 }
 
 void Icons::drawCheck(DisplayManager& disp, int x, int y) {
-  Adafruit_SSD1306& d = disp.getDisplay();
-
-  // Draw checkmark
-  d.drawLine(x - 3, y, x - 1, y + 2, SSD1306_WHITE);
-  d.drawLine(x - 1, y + 2, x + 3, y - 2, SSD1306_WHITE);
+  // Checkmark
+  disp.drawBitmapFast(x - 3, y - 2, ICON_CHECK, 7, 5);
 }
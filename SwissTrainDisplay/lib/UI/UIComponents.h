@@ -6,13 +6,48 @@
 #include "../../include/Config.h"
 #include "../../include/Types.h"
 
+// ====== MARQUEE COMPONENT ======
+// Horizontally scrolls text that is wider than its view.
+// tick() only advances the offset; the owning screen marks the affected
+// band dirty and repaints it in drawRegion() when the render task asks.
+
+class Marquee {
+private:
+  String text;
+  int textWidth;
+  int viewWidth;
+  int offset;
+  unsigned long lastStep;
+
+public:
+  Marquee();
+
+  // Set text and view width; scrolling restarts only if either changed
+  void setText(DisplayManager& disp, const String& newText, int visibleWidth);
+  const String& getText() const { return text; }
+
+  bool isScrolling() const { return textWidth > viewWidth; }
+  int getOffset() const { return offset; }
+  void reset();
+
+  // Advance scroll position; returns true when the offset changed
+  bool tick();
+
+  // Draw text at (x, y) shifted by the current offset (no wrapping)
+  void draw(DisplayManager& disp, int x, int y);
+};
+
 // ====== YELLOW BAR COMPONENT ======
 // Draws title/status bar in yellow zone (top 16px)
 
 class YellowBar {
 public:
   static void draw(DisplayManager& disp, const String& title, bool showWiFi = false, bool wifiConnected = false);
+  static void draw(DisplayManager& disp, Marquee& title, bool showWiFi = false, bool wifiConnected = false);
   static void drawWithTime(DisplayManager& disp, const String& title);
+
+  // Width available to the title text
+  static int titleWidth(bool showWiFi) { return SCREEN_WIDTH - 2 * TITLE_BAR_PADDING - (showWiFi ? 12 : 0); }
 };
 
 // ====== MENU LIST COMPONENT ======
@@ -22,6 +57,10 @@ class MenuList {
 private:
   int selectedIndex;
   int scrollOffset;
+  int selectedTextOffset;  // Horizontal marquee offset of the selected item
+
+  void drawRow(DisplayManager& disp, const String& text, int yPos, bool isSelected);
+  void drawScrollBar(DisplayManager& disp, int itemCount, int yStart);
 
 public:
   MenuList();
@@ -29,18 +68,26 @@ public:
   void draw(DisplayManager& disp, const String items[], int itemCount, int yStart = BLUE_ZONE_Y);
   void draw(DisplayManager& disp, const MenuItem items[], int itemCount, int yStart = BLUE_ZONE_Y);
 
+  // Repaint only the selected row (e.g. a marquee step) into the buffer
+  void redrawSelected(DisplayManager& disp, const String& text, int itemCount, int yStart = BLUE_ZONE_Y);
+
   void setSelected(int index) { selectedIndex = index; }
   int getSelected() const { return selectedIndex; }
+  void setSelectedTextOffset(int px) { selectedTextOffset = px; }
+
+  // Geometry of the selected row (for partial redraws and marquees)
+  int getSelectedRowY(int yStart = BLUE_ZONE_Y) const { return yStart + (selectedIndex - scrollOffset) * MENU_ITEM_HEIGHT; }
+  static int selectedTextWidth(int itemCount) { return SCREEN_WIDTH - 12 - (itemCount > MAX_VISIBLE_MENU_ITEMS ? 3 : 0); }
 
   void updateScroll(int itemCount, int maxVisible = MAX_VISIBLE_MENU_ITEMS);
 };
 
 // ====== CHARACTER SELECTOR COMPONENT ======
-// 5-character carousel for text input
+// 5-character carousel for text input; charset is a PROGMEM string
 
 class CharacterSelector {
 public:
-  static void draw(DisplayManager& disp, const char* charset, int charsetSize,
+  static void draw(DisplayManager& disp, PGM_P charset, int charsetSize,
                    int currentIndex, int yPos = 38);
 };
 
@@ -64,6 +111,15 @@ public:
                    int progress, int total);
 };
 
+// ====== ACTIVITY INDICATOR ======
+// Three dots with a moving highlight, phase taken from millis()
+
+class ActivityIndicator {
+public:
+  static void draw(DisplayManager& disp, int centerX, int y);
+  static bool frameChanged();  // True once per animation step
+};
+
 // ====== TEXT INPUT DISPLAY ======
 // Shows current input text with cursor
 
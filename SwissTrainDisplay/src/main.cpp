@@ -21,10 +21,21 @@
 #include "../lib/Input/EncoderHandler.h"
 #include "../lib/Input/ButtonHandler.h"
 #include "../lib/Storage/SettingsManager.h"
+#include "../lib/Storage/SettingsImage.h"
 #include "../lib/Data/PresetManager.h"
+#include "../lib/Data/StationIndex.h"
 #include "../lib/Data/TrainAPI.h"
 #include "../lib/Network/WiFiManager.h"
 #include "../lib/State/StateMachine.h"
+#include "../lib/System/TaskScheduler.h"
+#include "../lib/System/SerialConsole.h"
+#include "../lib/System/PowerManager.h"
+#ifdef ENABLE_RENDER_BENCHMARK
+#include "../lib/Diagnostics/RenderBenchmark.h"
+#endif
+#ifdef ENABLE_STORAGE_BENCHMARK
+#include "../lib/Diagnostics/StorageBenchmark.h"
+#endif
 
 // ====== GLOBAL OBJECTS ======
 // Use pointers to avoid global constructor issues
@@ -38,9 +49,329 @@ TrainAPI* trainAPI = nullptr;
 WiFiManager* wifiManager = nullptr;
 StateMachine* stateMachine = nullptr;
 
+TaskScheduler scheduler;
+SerialConsole console;
+PowerManager power;
+int buttonTaskId = -1;
+int inputTaskId = -1;
+int renderTaskId = -1;
+int fetchTaskId = -1;
+SettingsImageReader imageReader;
+unsigned long importStartedAt = 0;
+unsigned long lastSpaceCheckAt = 0;
+
+// ====== POWER ======
+
+bool hasPendingInput() {
+  return encoderHandler->hasEvents() || buttonHandler->hasPendingEdges() ||
+         buttonHandler->hasEvent() || buttonHandler->isPressedNow();
+}
+
+// Input/render tasks poll slowly while dozing; the ISR queues hold the input
+void applyPollingRate() {
+  bool dozing = power.isDozing();
+  scheduler.setPeriod(buttonTaskId, dozing ? POWER_DOZE_POLL_MS : TASK_BUTTON_PERIOD_MS);
+  scheduler.setPeriod(inputTaskId, dozing ? POWER_DOZE_POLL_MS : TASK_INPUT_PERIOD_MS);
+  scheduler.setPeriod(renderTaskId, dozing ? POWER_DOZE_POLL_MS : TASK_RENDER_PERIOD_MS);
+}
+
+void wakeOnInput() {
+  if (power.noteActivity()) {
+    applyPollingRate();
+    scheduler.runNow(buttonTaskId);
+    scheduler.runNow(inputTaskId);
+    scheduler.runNow(renderTaskId);
+  }
+}
+
+void onSchedulerIdle(unsigned long maxSleepMs) {
+  power.idle(maxSleepMs);
+  if (hasPendingInput()) {
+    wakeOnInput();
+  }
+}
+
+// ====== TASKS ======
+// Registered in priority order: input first, slow work last
+
+void taskButton() {
+  buttonHandler->update();
+}
+
+void taskInput() {
+  if (hasPendingInput()) {
+    wakeOnInput();  // Also restarts the idle timeout
+  }
+  stateMachine->handleInput();
+}
+
+void taskRender() {
+  stateMachine->render();
+}
+
+void taskFetch() {
+  // Only refresh while the departure board is visible (the HTTP request blocks)
+  if (!wifiManager->isConnected() || stateMachine->getCurrentState() != STATE_MAIN_DISPLAY) {
+    return;
+  }
+
+  const Preset* current = presetManager->getCurrent();
+  if (!current || current->type != PRESET_TRAIN) {
+    return;
+  }
+
+  std::vector<TrainConnection> connections;
+  if (trainAPI->fetchConnections(current->fromStation, current->toStation, connections, current->trainsToDisplay)) {
+    stateMachine->requestRedraw();
+  }
+}
+
+// Fresh data as soon as a connection comes up (boot, new credentials, reconnect)
+void onWiFiConnected() {
+  scheduler.runNow(fetchTaskId);
+}
+
+void taskWiFi() {
+  wifiManager->supervise();
+}
+
+void taskNtp() {
+  if (wifiManager->isConnected()) {
+    configTime(TIMEZONE_OFFSET_SEC, DAYLIGHT_OFFSET_SEC, NTP_SERVER1, NTP_SERVER2);
+  }
+}
+
+void taskStorage() {
+  // Coalesces bursts of preset edits into one delayed write
+  presetManager->flushIfDue();
+
+  // Reclaim space before the 64 KB partition fills and writes start failing
+  if (millis() - lastSpaceCheckAt >= STORAGE_CHECK_INTERVAL_MS) {
+    lastSpaceCheckAt = millis();
+    settingsManager->compactIfLow();
+    settingsManager->saveWearTotals();
+  }
+}
+
+void taskPower() {
+  Screen* screen = stateMachine->getCurrentScreen();
+  bool allowsSleep = !(screen && screen->needsContinuousRefresh()) &&
+                     !wifiManager->isConnectingNow() && !wifiManager->isScanning();
+  if (power.update(allowsSleep)) {
+    applyPollingRate();
+    if (power.isDozing()) {
+      presetManager->flush();  // Don't leave the current preset pending while asleep
+    }
+  }
+}
+
+void taskConsole() {
+  console.poll();
+}
+
+// ====== CONSOLE COMMANDS ======
+
+void cmdStats(const String& args) {
+  if (args == "reset") {
+    scheduler.resetStats();
+    Serial.println("Stats reset");
+    return;
+  }
+  scheduler.printStats();
+  stateMachine->printRenderStats();
+}
+
+void cmdLatency(const String& args) {
+  if (args == "reset") {
+    stateMachine->getLatencyTracker().reset();
+    Serial.println("Latency reset");
+    return;
+  }
+  stateMachine->getLatencyTracker().print();
+}
+
+void cmdAccel(const String& args) {
+  // accel <minDps> <maxDps> <maxMultiplier>
+  int first = args.indexOf(' ');
+  int second = (first < 0) ? -1 : args.indexOf(' ', first + 1);
+  if (second > 0) {
+    AccelerationCurve curve(args.substring(0, first).toInt(),
+                            args.substring(first + 1, second).toInt(),
+                            args.substring(second + 1).toInt());
+    encoderHandler->setAccelerationCurve(curve);
+  }
+
+  const AccelerationCurve& curve = encoderHandler->getAccelerationCurve();
+  Serial.printf("Encoder acceleration: %u..%u detents/s, up to x%u\n",
+                curve.minDps, curve.maxDps, curve.maxMultiplier);
+}
+
+void cmdWiFi(const String& args) {
+  Serial.printf("WiFi: %s, SSID '%s', IP %s, RSSI %d dBm\n",
+                wifiManager->isConnected() ? "connected" : "offline",
+                wifiManager->getSSID().c_str(), wifiManager->getIP().c_str(), wifiManager->getRSSI());
+  Serial.printf("Last time-to-IP: %lu ms (%s path)\n", wifiManager->getLastTimeToIP(),
+                wifiManager->wasLastConnectFast() ? "fast" : "full");
+
+  const WiFiFastConnect& fast = wifiManager->getFastConnectData();
+  Serial.printf("Cached: ch %d, %s IP %s\n", (int)fast.channel,
+                fast.staticIP ? "static" : "lease", IPAddress(fast.ip).toString().c_str());
+
+  const WiFiReconnectStats& rs = wifiManager->getReconnectStats();
+  Serial.printf("Link losses: %lu, attempts: %lu, reconnects: %lu\n",
+                (unsigned long)rs.disconnects, (unsigned long)rs.attempts, (unsigned long)rs.reconnects);
+  Serial.printf("Downtime: total %lu ms, longest %lu ms, last %lu ms\n",
+                (unsigned long)rs.totalDowntimeMs, (unsigned long)rs.longestDowntimeMs,
+                (unsigned long)rs.lastDowntimeMs);
+  if (wifiManager->getCurrentDowntime() > 0) {
+    Serial.printf("Down for %lu ms, next retry in %lu ms\n",
+                  wifiManager->getCurrentDowntime(), wifiManager->getNextRetryIn());
+  }
+}
+
+void cmdStaticIP(const String& args) {
+  // staticip <ip> <gateway> <subnet> [dns] | staticip off
+  if (args == "off") {
+    wifiManager->clearStaticIP();
+    return;
+  }
+
+  IPAddress addr[4];
+  int count = 0;
+  int start = 0;
+  while (count < 4 && start < (int)args.length()) {
+    int end = args.indexOf(' ', start);
+    if (end < 0) {
+      end = args.length();
+    }
+    if (!addr[count].fromString(args.substring(start, end).c_str())) {
+      break;
+    }
+    count++;
+    start = end + 1;
+  }
+
+  if (count < 3) {
+    Serial.println("Usage: staticip <ip> <gateway> <subnet> [dns] | staticip off");
+    return;
+  }
+  if (!wifiManager->setStaticIP(addr[0], addr[1], addr[2], count > 3 ? addr[3] : addr[1])) {
+    Serial.println("ERROR: " + wifiManager->getLastError().message);
+  }
+}
+
+void cmdPower(const String& args) {
+  // power [always|modem|light|reset]
+  if (args == "always") {
+    power.setMode(POWER_MODE_ALWAYS_ON);
+    applyPollingRate();
+  } else if (args == "modem") {
+    power.setMode(POWER_MODE_MODEM_SLEEP);
+  } else if (args == "light") {
+    power.setMode(POWER_MODE_LIGHT_SLEEP);
+  } else if (args == "reset") {
+    power.resetStats();
+  }
+  power.printStats();
+}
+
+void cmdPresets(const String& args) {
+  // presets [flush]
+  if (args == "flush") {
+    presetManager->flush();
+  }
+  Serial.printf("Presets: %d, current %d, %s\n", presetManager->getCount(),
+                presetManager->getCurrentIndex(), presetManager->hasDirtyFlag() ? "unsaved changes" : "clean");
+  Serial.printf("Flushes: %lu, index writes: %lu (slot %d), skipped no-op updates: %lu\n",
+                (unsigned long)presetManager->getFlushCount(), (unsigned long)presetManager->getIndexWrites(),
+                settingsManager->getCurrentPresetSlot(), (unsigned long)presetManager->getSkippedWrites());
+  Serial.printf("Preset cache: %d loaded, %lu hits, %lu misses\n", presetManager->getCachedCount(),
+                (unsigned long)presetManager->getCacheHits(), (unsigned long)presetManager->getCacheMisses());
+  settingsManager->getPresetJournal().printStats();
+}
+
+void cmdRestart(const String& args) {
+  // Persist pending presets and the current index before rebooting
+  presetManager->flush();
+  settingsManager->saveWearTotals(true);
+  Serial.println("Restarting...");
+  Serial.flush();
+  ESP.restart();
+}
+
+void cmdCompact(const String& args) {
+  // Write pending edits first so the snapshot holds the latest presets
+  presetManager->flush();
+  StorageCompactReport report;
+  settingsManager->compactStorage(report);
+}
+
+void cmdStorage(const String& args) {
+  // storage [save] - "save" persists the lifetime write counters now
+  if (args == "save") {
+    settingsManager->saveWearTotals(true);
+  }
+  settingsManager->printTelemetry();
+}
+
+void cmdStations(const String& args) {
+  // stations <prefix> - list matching names and time the flash lookup
+  String results[8];
+  int total = 0;
+  unsigned long start = micros();
+  int found = StationIndex::complete(args, results, 8, &total);
+  unsigned long elapsed = micros() - start;
+
+  for (int i = 0; i < found; i++) {
+    Serial.printf("  %s\n", results[i].c_str());
+  }
+  if (total > found) {
+    Serial.printf("  ... %d more\n", total - found);
+  }
+  Serial.printf("%d of %d stations match '%s' (%lu us)\n", total, StationIndex::getCount(), args.c_str(), elapsed);
+}
+
+void cmdExport(const String& args) {
+  // export [presets] - "presets" leaves the WiFi credentials out
+  if (!presetManager->flush()) {
+    Serial.println("ERROR: Cannot export, pending presets not saved");
+    return;
+  }
+  SettingsImage::exportStored(*settingsManager, presetManager->getCurrentIndex(), args != "presets", Serial);
+}
+
+bool importLine(const String& line) {
+  // Acknowledge each line so the sender never has more than one in flight;
+  // fetches and flash writes can block the loop longer than the RX buffer lasts
+  if (imageReader.feed(line)) {
+    Serial.println("ACK");
+    return true;
+  }
+
+  if (imageReader.succeeded() && imageReader.apply(*settingsManager)) {
+    presetManager->loadAll();
+    stateMachine->requestRedraw();
+    Serial.printf("OK %d presets in %lu ms%s\n", presetManager->getCount(), millis() - importStartedAt,
+                  imageReader.includesWiFi() ? ", WiFi applies after restart" : "");
+  } else {
+    Serial.println("ERROR: Import failed: " + imageReader.getError());
+  }
+  imageReader.begin();  // Release the decoded body
+  return false;
+}
+
+void cmdImport(const String& args) {
+  // import - then send the lines printed by "export", each after the previous "ACK"
+  imageReader.begin();
+  importStartedAt = millis();
+  Serial.println("READY");
+  console.capture(importLine, SETTINGS_IMAGE_TIMEOUT_MS);
+}
+
 // ====== SETUP ======
 
 void setup() {
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER_BYTES);
   Serial.begin(115200);
   delay(500);
   Serial.println("\n\n========================================");
@@ -55,7 +386,7 @@ void setup() {
   buttonHandler = new ButtonHandler();
   settingsManager = new SettingsManager();
   trainAPI = new TrainAPI();
-  wifiManager = new WiFiManager();
+  wifiManager = new WiFiManager(settingsManager);
 
   Serial.println("Managers created");
 
@@ -67,6 +398,10 @@ void setup() {
     }
   }
 
+#ifdef ENABLE_RENDER_BENCHMARK
+  RenderBenchmark::run(*displayManager);
+#endif
+
   // Show splash screen
   displayManager->clear();
   displayManager->drawCenteredText("Swiss", 15, 2);
@@ -93,39 +428,25 @@ void setup() {
   presetManager->loadAll();
   Serial.printf("Loaded %d presets\n", presetManager->getCount());
 
-  // Auto-connect to WiFi if credentials exist
+#ifdef ENABLE_STORAGE_BENCHMARK
+  {
+    std::vector<Preset> benchPresets;
+    for (int i = 0; i < presetManager->getCount(); i++) {
+      benchPresets.push_back(*presetManager->getPreset(i));
+    }
+    StorageBenchmark::run(benchPresets);
+  }
+#endif
+
+  // Start WiFi in the background; MainScreen shows progress while it connects
+  wifiManager->begin();
+  wifiManager->setOnConnected(onWiFiConnected);
+
   String ssid, password;
   if (settingsManager->loadWiFiCredentials(ssid, password)) {
-    Serial.println("Attempting WiFi auto-connect...");
-
-    displayManager->clear();
-    displayManager->drawCenteredText("Connecting WiFi...", 28, 1);
-    displayManager->show();
-
-    if (wifiManager->connect(ssid, password, WIFI_CONNECT_TIMEOUT_MS)) {
-      Serial.println("WiFi connected!");
-
-      displayManager->clear();
-      displayManager->drawCenteredText("WiFi Connected!", 28, 1);
-      displayManager->show();
-      delay(1500);
-
-      // Fetch initial train data if current preset is a train
-      const Preset* current = presetManager->getCurrent();
-      if (current && current->type == PRESET_TRAIN) {
-        std::vector<TrainConnection> connections;
-        int limit = current->trainsToDisplay;
-        trainAPI->fetchConnections(current->fromStation, current->toStation, connections, limit);
-      }
-    } else {
-      Serial.println("WiFi connection failed");
-
-      displayManager->clear();
-      displayManager->drawCenteredText("WiFi Failed", 20, 1);
-      displayManager->drawCenteredText("Check settings", 35, 1);
-      displayManager->show();
-      delay(2000);
-    }
+    Serial.println("Starting WiFi auto-connect...");
+    wifiManager->setCredentials(ssid, password);  // Supervisor keeps retrying these
+    wifiManager->connect(ssid, password, WIFI_CONNECT_TIMEOUT_MS);
   } else {
     Serial.println("No WiFi credentials saved");
   }
@@ -145,6 +466,38 @@ void setup() {
 
   stateMachine->begin();
 
+  // Register cooperative tasks
+  buttonTaskId = scheduler.addTask("button", taskButton, TASK_BUTTON_PERIOD_MS, TASK_BUTTON_DEADLINE_MS);
+  inputTaskId = scheduler.addTask("input", taskInput, TASK_INPUT_PERIOD_MS, TASK_INPUT_DEADLINE_MS);
+  renderTaskId = scheduler.addTask("render", taskRender, TASK_RENDER_PERIOD_MS, TASK_RENDER_DEADLINE_MS);
+  scheduler.addTask("console", taskConsole, TASK_CONSOLE_PERIOD_MS, TASK_CONSOLE_DEADLINE_MS);
+  scheduler.addTask("storage", taskStorage, TASK_STORAGE_PERIOD_MS, TASK_STORAGE_DEADLINE_MS);
+  scheduler.addTask("wifi", taskWiFi, TASK_WIFI_PERIOD_MS, TASK_WIFI_DEADLINE_MS);
+  scheduler.addTask("power", taskPower, TASK_POWER_PERIOD_MS, TASK_POWER_DEADLINE_MS);
+  // Connecting configures NTP and triggers a fetch - periodic runs start after one period
+  scheduler.addTask("ntp", taskNtp, TASK_NTP_PERIOD_MS, TASK_NTP_DEADLINE_MS, TASK_NTP_PERIOD_MS);
+  fetchTaskId = scheduler.addTask("fetch", taskFetch, TASK_FETCH_PERIOD_MS, TASK_FETCH_DEADLINE_MS, TASK_FETCH_PERIOD_MS);
+
+  // Sleep between tasks; encoder and button GPIO wake the CPU
+  const int wakePins[] = {ENCODER_SW, ENCODER_CLK, ENCODER_DT};
+  power.begin(POWER_DEFAULT_MODE, wakePins, 3);
+  power.setWakeCheck(hasPendingInput);
+  scheduler.setIdleHandler(onSchedulerIdle);
+
+  console.addCommand("stats", "Scheduler and render stats ('stats reset' clears)", cmdStats);
+  console.addCommand("latency", "Input-to-photon latency per screen ('latency reset' clears)", cmdLatency);
+  console.addCommand("accel", "Show/set encoder acceleration: accel <min> <max> <mult>", cmdAccel);
+  console.addCommand("wifi", "WiFi status, time-to-IP and reconnect stats", cmdWiFi);
+  console.addCommand("staticip", "Static IP: staticip <ip> <gw> <mask> [dns] | off", cmdStaticIP);
+  console.addCommand("power", "Power mode and awake %: power [always|modem|light|reset]", cmdPower);
+  console.addCommand("presets", "Preset persistence stats ('presets flush' writes now)", cmdPresets);
+  console.addCommand("restart", "Save pending changes and reboot", cmdRestart);
+  console.addCommand("storage", "Storage usage, writes per key class and wear ('storage save')", cmdStorage);
+  console.addCommand("compact", "Compact preset storage and report reclaimed/free bytes", cmdCompact);
+  console.addCommand("export", "Print settings image: export [presets] (omit WiFi)", cmdExport);
+  console.addCommand("import", "Read a settings image from the following lines", cmdImport);
+  console.addCommand("stations", "Station names starting with a prefix: stations <prefix>", cmdStations);
+
   Serial.println("\n========================================");
   Serial.println("System ready!");
   Serial.println("========================================\n");
@@ -153,14 +506,6 @@ void setup() {
 // ====== MAIN LOOP ======
 
 void loop() {
-  // Update button state (must be called every loop)
-  buttonHandler->update();
-
-  // Update state machine (handles input and rendering)
-  if (stateMachine) {
-    stateMachine->update();
-  }
-
-  // Small delay to prevent overwhelming the system
-  delay(50);
+  // Run whatever is due; sleeps via the power manager when idle
+  scheduler.run();
 }
@@ -0,0 +1,84 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// ====== HOST ARDUINO SHIM ======
+// Just enough of the Arduino core to build hardware-independent units
+// (codecs, journal, curves) for `pio test -e native`. Serial output is
+// discarded; time comes from the host clock.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT_PULLUP 2
+#define CHANGE 3
+#define IRAM_ATTR
+#define PROGMEM
+#define PGM_P const char*
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define memcpy_P memcpy
+
+using std::min;
+using std::max;
+
+class String {
+  std::string s;
+
+public:
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const std::string& c) : s(c) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+
+  unsigned int length() const { return s.size(); }
+  const char* c_str() const { return s.c_str(); }
+  char operator[](unsigned int i) const { return s[i]; }
+  char& operator[](unsigned int i) { return s[i]; }
+  bool reserve(unsigned int n) { s.reserve(n); return true; }
+  bool concat(const char* c, unsigned int n) { s.append(c, n); return true; }
+  void remove(unsigned int i) { s.erase(i); }
+  String substring(unsigned int a) const { return a < s.size() ? String(s.substr(a)) : String(); }
+  String substring(unsigned int a, unsigned int b) const { return a < s.size() ? String(s.substr(a, b - a)) : String(); }
+
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char o) { s += o; return *this; }
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator!=(const String& o) const { return s != o.s; }
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+};
+
+class HardwareSerial {
+public:
+  template <typename T> size_t print(const T&) { return 0; }
+  template <typename T> size_t println(const T&) { return 0; }
+  size_t println() { return 0; }
+  size_t printf(const char*, ...) { return 0; }
+};
+
+// One instance per test program (inline variable, no .cpp needed)
+inline HardwareSerial Serial;
+
+inline unsigned long micros() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+
+inline void pinMode(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#endif // NATIVE_ARDUINO_H
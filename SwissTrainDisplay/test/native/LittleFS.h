@@ -0,0 +1,97 @@
+#ifndef NATIVE_LITTLEFS_H
+#define NATIVE_LITTLEFS_H
+
+// ====== HOST LITTLEFS SHIM ======
+// In-memory filesystem with the calls the journal uses. Tests reach the
+// raw bytes through LittleFS.files to truncate or corrupt them, and
+// inject write faults through littleFSFaults.
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+struct LittleFSFaults {
+  size_t writeBudget;  // Bytes writes may still store (a full partition)
+  bool failTruncate;
+};
+
+inline LittleFSFaults littleFSFaults = {SIZE_MAX, false};
+
+class File {
+private:
+  std::vector<uint8_t>* data;
+  size_t pos;
+
+public:
+  File() : data(nullptr), pos(0) {}
+  File(std::vector<uint8_t>* d, size_t p) : data(d), pos(p) {}
+
+  operator bool() const { return data != nullptr; }
+  size_t size() const { return data ? data->size() : 0; }
+  size_t position() const { return pos; }
+
+  bool seek(uint32_t p) {
+    if (!data || p > data->size()) return false;
+    pos = p;
+    return true;
+  }
+
+  size_t read(uint8_t* buf, size_t n) {
+    n = min(n, data->size() - pos);
+    memcpy(buf, data->data() + pos, n);
+    pos += n;
+    return n;
+  }
+
+  size_t write(const uint8_t* buf, size_t n) {
+    n = min(n, littleFSFaults.writeBudget);
+    littleFSFaults.writeBudget -= n;
+    if (data->size() < pos + n) data->resize(pos + n);
+    memcpy(data->data() + pos, buf, n);
+    pos += n;
+    return n;
+  }
+
+  bool truncate(uint32_t size) {
+    if (littleFSFaults.failTruncate || size > data->size()) return false;
+    data->resize(size);
+    pos = min(pos, (size_t)size);
+    return true;
+  }
+
+  void flush() {}
+  void close() { data = nullptr; }
+};
+
+class LittleFSClass {
+public:
+  std::map<std::string, std::vector<uint8_t>> files;
+
+  bool begin() { return true; }
+  bool exists(const String& path) { return files.count(path.c_str()) > 0; }
+  bool remove(const String& path) { return files.erase(path.c_str()) > 0; }
+
+  bool rename(const String& from, const String& to) {
+    auto it = files.find(from.c_str());
+    if (it == files.end()) return false;
+    files[to.c_str()].swap(it->second);
+    files.erase(from.c_str());
+    return true;
+  }
+
+  File open(const String& path, const char* mode) {
+    std::string key = path.c_str();
+    if (mode[0] == 'r') {
+      auto it = files.find(key);
+      return it == files.end() ? File() : File(&it->second, 0);
+    }
+    std::vector<uint8_t>& data = files[key];
+    if (mode[0] == 'w') data.clear();
+    return File(&data, data.size());
+  }
+};
+
+inline LittleFSClass LittleFS;
+
+#endif // NATIVE_LITTLEFS_H
@@ -0,0 +1,115 @@
+// Encoder acceleration curve and the speed tracking that feeds it,
+// driven with synthetic detent streams instead of the ISR.
+
+#include <unity.h>
+
+// Unit under test - the native env links no libraries (lib_ldf_mode = off)
+#include "../../lib/Input/EncoderHandler.cpp"
+
+// 8..40 detents/s ramps from 1 to 6 steps per detent
+static const AccelerationCurve CURVE(8, 40, 6);
+
+static const unsigned long SLOW_US = 200000;   // 5 detents/s
+static const unsigned long MEDIUM_US = 40000;  // 25 detents/s
+static const unsigned long FAST_US = 10000;    // 100 detents/s
+
+void setUp() {}
+void tearDown() {}
+
+// ====== CURVE ======
+
+void test_slow_rotation_is_one_step() {
+  TEST_ASSERT_EQUAL(1, EncoderHandler::accelerate(1, SLOW_US, CURVE));
+  TEST_ASSERT_EQUAL(1, EncoderHandler::accelerate(1, 125000, CURVE));  // Exactly minDps
+}
+
+void test_medium_rotation_ramps_linearly() {
+  // 25 dps: 1 + round((25 - 8) * 5 / 32) = 4
+  TEST_ASSERT_EQUAL(4, EncoderHandler::accelerate(1, MEDIUM_US, CURVE));
+  // 20 dps: 1 + round(12 * 5 / 32) = 3
+  TEST_ASSERT_EQUAL(3, EncoderHandler::accelerate(1, 50000, CURVE));
+}
+
+void test_fast_rotation_is_capped() {
+  TEST_ASSERT_EQUAL(6, EncoderHandler::accelerate(1, 25000, CURVE));  // Exactly maxDps
+  TEST_ASSERT_EQUAL(6, EncoderHandler::accelerate(1, FAST_US, CURVE));
+  TEST_ASSERT_EQUAL(6, EncoderHandler::accelerate(1, 1, CURVE));
+}
+
+void test_sign_is_preserved() {
+  TEST_ASSERT_EQUAL(-1, EncoderHandler::accelerate(-1, SLOW_US, CURVE));
+  TEST_ASSERT_EQUAL(-4, EncoderHandler::accelerate(-1, MEDIUM_US, CURVE));
+  TEST_ASSERT_EQUAL(-6, EncoderHandler::accelerate(-1, FAST_US, CURVE));
+}
+
+void test_no_interval_or_flat_curve_is_one_step() {
+  TEST_ASSERT_EQUAL(1, EncoderHandler::accelerate(1, 0, CURVE));
+  TEST_ASSERT_EQUAL(-1, EncoderHandler::accelerate(-1, 0, CURVE));
+  TEST_ASSERT_EQUAL(1, EncoderHandler::accelerate(1, FAST_US, AccelerationCurve(8, 40, 1)));
+  TEST_ASSERT_EQUAL(1, EncoderHandler::accelerate(1, FAST_US, AccelerationCurve(40, 40, 6)));
+}
+
+// ====== EVENT STREAMS ======
+
+// Feed one detent and return the steps it is worth
+static int feed(EncoderHandler& encoder, int delta, unsigned long timestamp) {
+  EncoderEvent event(delta, 0, timestamp);
+  encoder.trackEvent(event);
+  return encoder.getAcceleratedDelta(event);
+}
+
+void test_stream_accelerates_after_first_detent() {
+  EncoderHandler encoder;
+  encoder.setAccelerationCurve(CURVE);
+  unsigned long t = 1000000;
+  TEST_ASSERT_EQUAL(1, feed(encoder, 1, t));  // No interval yet
+  TEST_ASSERT_EQUAL(6, feed(encoder, 1, t += FAST_US));
+  TEST_ASSERT_EQUAL(6, feed(encoder, 1, t += FAST_US));
+  TEST_ASSERT_EQUAL(4, feed(encoder, 1, t += MEDIUM_US));
+  TEST_ASSERT_EQUAL(1, feed(encoder, 1, t += SLOW_US));
+}
+
+void test_direction_change_resets_speed() {
+  EncoderHandler encoder;
+  encoder.setAccelerationCurve(CURVE);
+  unsigned long t = 1000000;
+  feed(encoder, 1, t);
+  TEST_ASSERT_EQUAL(6, feed(encoder, 1, t += FAST_US));
+  TEST_ASSERT_EQUAL(-1, feed(encoder, -1, t += FAST_US));
+  TEST_ASSERT_EQUAL(-6, feed(encoder, -1, t += FAST_US));
+}
+
+void test_same_timestamp_jump_keeps_spin_speed() {
+  // One interrupt queued three detents with the same timestamp (interval 0)
+  EncoderHandler encoder;
+  encoder.setAccelerationCurve(CURVE);
+  unsigned long t = 1000000;
+  feed(encoder, -1, t);
+  TEST_ASSERT_EQUAL(-6, feed(encoder, -1, t += FAST_US));
+  TEST_ASSERT_EQUAL(-6, feed(encoder, -1, t += FAST_US));
+  TEST_ASSERT_EQUAL(-6, feed(encoder, -1, t));
+  TEST_ASSERT_EQUAL(-6, feed(encoder, -1, t));
+}
+
+void test_same_timestamp_jump_from_rest_is_one_step() {
+  EncoderHandler encoder;
+  encoder.setAccelerationCurve(CURVE);
+  unsigned long t = 1000000;
+  TEST_ASSERT_EQUAL(1, feed(encoder, 1, t));
+  TEST_ASSERT_EQUAL(1, feed(encoder, 1, t));
+  TEST_ASSERT_EQUAL(1, feed(encoder, 1, t));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_slow_rotation_is_one_step);
+  RUN_TEST(test_medium_rotation_ramps_linearly);
+  RUN_TEST(test_fast_rotation_is_capped);
+  RUN_TEST(test_sign_is_preserved);
+  RUN_TEST(test_no_interval_or_flat_curve_is_one_step);
+  RUN_TEST(test_stream_accelerates_after_first_detent);
+  RUN_TEST(test_direction_change_resets_speed);
+  RUN_TEST(test_same_timestamp_jump_keeps_spin_speed);
+  RUN_TEST(test_same_timestamp_jump_from_rest_is_one_step);
+  return UNITY_END();
+}
@@ -0,0 +1,256 @@
+// Fault injection for the preset journal: a log holding a 100-preset
+// snapshot and later transactions is cut short and corrupted at every
+// byte offset; recovery must always produce the last table whose commit
+// record lies entirely before the damage.
+
+#include <unity.h>
+#include <stdio.h>
+
+// Units under test - the native env links no libraries (lib_ldf_mode = off)
+#include "../../lib/Storage/PresetCodec.cpp"
+#include "../../lib/Storage/PresetJournal.cpp"
+
+#define PRESET_COUNT 100
+#define RECOVERY_BOUND_US 50000  // Host bound; the device figure comes from 'presets'
+
+static std::vector<std::vector<Preset>> committedTables;  // Table after each commit
+static std::vector<size_t> commitEnds;                     // Log size after each commit
+static std::vector<uint8_t> fullLog;
+
+static Preset makePreset(int i, int revision) {
+  char name[16];
+  snprintf(name, sizeof(name), "P%03d r%d", i, revision);
+  Preset preset(name, i % 2 ? "Lausanne" : "Zurich HB", i % 3 ? "Geneve" : "Bern");
+  preset.trainsToDisplay = 1 + i % 4;
+  return preset;
+}
+
+static void noteCommit(PresetJournal& journal, const std::vector<Preset>& table) {
+  committedTables.push_back(table);
+  commitEnds.push_back(journal.getFileSize());
+}
+
+static void commitUpdates(PresetJournal& journal, std::vector<Preset>& table,
+                          std::initializer_list<int> indices, int revision) {
+  std::vector<std::pair<int, const Preset*>> records;
+  for (int i : indices) {
+    table[i] = makePreset(i, revision);
+  }
+  for (int i : indices) {
+    records.push_back(std::make_pair(i, &table[i]));
+  }
+  TEST_ASSERT_TRUE(journal.commitUpdates(records, table.size()));
+  noteCommit(journal, table);
+}
+
+static void buildLog() {
+  LittleFS.files.clear();
+  committedTables.clear();
+  commitEnds.clear();
+
+  PresetJournal journal;
+  std::vector<Preset> table;
+  for (int i = 0; i < PRESET_COUNT; i++) {
+    table.push_back(makePreset(i, 0));
+  }
+  TEST_ASSERT_TRUE(journal.commitSnapshot(table));
+  noteCommit(journal, table);
+
+  commitUpdates(journal, table, {3, 50, 99}, 1);
+  commitUpdates(journal, table, {0}, 2);
+
+  table.push_back(makePreset(PRESET_COUNT, 0));  // Structural change: new snapshot
+  TEST_ASSERT_TRUE(journal.commitSnapshot(table));
+  noteCommit(journal, table);
+
+  commitUpdates(journal, table, {7, PRESET_COUNT}, 3);
+
+  // Everything above must be appended, not compacted away
+  TEST_ASSERT_EQUAL(0, journal.getStats().compactions);
+  fullLog = LittleFS.files[PRESET_JOURNAL_PATH];
+  TEST_ASSERT_EQUAL(commitEnds.back(), fullLog.size());
+}
+
+// Last table whose commit record ends at or before the first damaged byte
+static const std::vector<Preset>* expectedTable(size_t intactBytes) {
+  const std::vector<Preset>* expected = nullptr;
+  for (size_t k = 0; k < commitEnds.size(); k++) {
+    if (commitEnds[k] <= intactBytes) {
+      expected = &committedTables[k];
+    }
+  }
+  return expected;
+}
+
+static void checkRecovery(size_t intactBytes, const char* fault) {
+  char message[64];
+  snprintf(message, sizeof(message), "%s at offset %u", fault, (unsigned)intactBytes);
+
+  PresetJournal journal;
+  std::vector<PresetSummary> summaries;
+  bool recovered = journal.recover(summaries);
+
+  const std::vector<Preset>* expected = expectedTable(intactBytes);
+  if (!expected) {
+    TEST_ASSERT_FALSE_MESSAGE(recovered, message);
+    return;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(recovered, message);
+  TEST_ASSERT_EQUAL_MESSAGE(expected->size(), summaries.size(), message);
+
+  for (size_t i = 0; i < summaries.size(); i++) {
+    const Preset& want = (*expected)[i];
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(want.name.c_str(), summaries[i].label.c_str(), message);
+
+    Preset loaded;
+    TEST_ASSERT_TRUE_MESSAGE(journal.loadRecord(summaries[i].stored, loaded), message);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(want.fromStation.c_str(), loaded.fromStation.c_str(), message);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(want.toStation.c_str(), loaded.toStation.c_str(), message);
+    TEST_ASSERT_EQUAL_MESSAGE(want.trainsToDisplay, loaded.trainsToDisplay, message);
+  }
+}
+
+// Report the scan time of the last recover() and hold it to a loose bound
+static void reportRecoveryTime(const PresetJournal& journal, const char* what) {
+  char message[80];
+  unsigned long us = journal.getStats().lastRecoveryUs;
+  snprintf(message, sizeof(message), "%s recovery of %d presets: %lu us", what, journal.getSlotCount(), us);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE_MESSAGE(us < RECOVERY_BOUND_US, message);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_intact_log_recovers_last_commit() {
+  buildLog();
+  checkRecovery(fullLog.size(), "intact");
+
+  PresetJournal journal;
+  std::vector<PresetSummary> summaries;
+  TEST_ASSERT_TRUE(journal.recover(summaries));
+  reportRecoveryTime(journal, "Intact");
+}
+
+void test_truncation_at_every_offset() {
+  buildLog();
+  for (size_t n = 0; n < fullLog.size(); n++) {
+    LittleFS.files.clear();
+    LittleFS.files[PRESET_JOURNAL_PATH].assign(fullLog.begin(), fullLog.begin() + n);
+    checkRecovery(n, "truncated");
+  }
+}
+
+void test_corruption_at_every_offset() {
+  buildLog();
+  for (size_t n = 0; n < fullLog.size(); n++) {
+    LittleFS.files.clear();
+    std::vector<uint8_t>& log = LittleFS.files[PRESET_JOURNAL_PATH];
+    log = fullLog;
+    log[n] ^= 0xFF;
+    checkRecovery(n, "corrupted");
+  }
+}
+
+void test_recovered_tail_is_rewritten() {
+  // After dropping a torn tail the log must accept appends again
+  buildLog();
+  LittleFS.files.clear();
+  LittleFS.files[PRESET_JOURNAL_PATH].assign(fullLog.begin(), fullLog.end() - 5);
+
+  PresetJournal journal;
+  std::vector<PresetSummary> summaries;
+  TEST_ASSERT_TRUE(journal.recover(summaries));
+  reportRecoveryTime(journal, "Torn-tail");
+  Preset changed = makePreset(1, 9);
+  std::vector<std::pair<int, const Preset*>> records = {std::make_pair(1, &changed)};
+  TEST_ASSERT_TRUE(journal.commitUpdates(records, summaries.size()));
+
+  PresetJournal reopened;
+  TEST_ASSERT_TRUE(reopened.recover(summaries));
+  TEST_ASSERT_EQUAL_STRING(changed.name.c_str(), summaries[1].label.c_str());
+}
+
+void test_torn_first_save_is_discarded() {
+  // Power cut during the very first snapshot: no commit ever landed
+  buildLog();
+  LittleFS.files.clear();
+  LittleFS.files[PRESET_JOURNAL_PATH].assign(fullLog.begin(), fullLog.begin() + commitEnds[0] - 1);
+
+  PresetJournal journal;
+  std::vector<PresetSummary> summaries;
+  TEST_ASSERT_FALSE(journal.recover(summaries));
+
+  // The defaults saved next must survive the following boot
+  std::vector<Preset> defaults = {makePreset(0, 5), makePreset(1, 5)};
+  TEST_ASSERT_TRUE(journal.commitSnapshot(defaults));
+
+  PresetJournal reopened;
+  TEST_ASSERT_TRUE(reopened.recover(summaries));
+  TEST_ASSERT_EQUAL(defaults.size(), summaries.size());
+  TEST_ASSERT_EQUAL_STRING(defaults[1].name.c_str(), summaries[1].label.c_str());
+}
+
+// A commit cut short by a full partition, then one that succeeds
+static void checkShortWrite(bool truncateWorks) {
+  LittleFS.files.clear();
+  PresetJournal journal;
+  std::vector<Preset> table;
+  for (int i = 0; i < PRESET_COUNT; i++) {
+    table.push_back(makePreset(i, 0));
+  }
+  TEST_ASSERT_TRUE(journal.commitSnapshot(table));
+
+  Preset lost = makePreset(4, 1);
+  std::vector<std::pair<int, const Preset*>> records = {std::make_pair(4, &lost)};
+  littleFSFaults = {3, !truncateWorks};
+  TEST_ASSERT_FALSE(journal.commitUpdates(records, table.size()));
+  littleFSFaults = {SIZE_MAX, false};
+
+  table[5] = makePreset(5, 2);
+  records = {std::make_pair(5, &table[5])};
+  TEST_ASSERT_TRUE(journal.commitUpdates(records, table.size()));
+
+  PresetJournal reopened;
+  std::vector<PresetSummary> summaries;
+  TEST_ASSERT_TRUE(reopened.recover(summaries));
+  TEST_ASSERT_EQUAL(0, reopened.getStats().discardedBytes);
+  TEST_ASSERT_EQUAL_STRING(table[4].name.c_str(), summaries[4].label.c_str());
+  TEST_ASSERT_EQUAL_STRING(table[5].name.c_str(), summaries[5].label.c_str());
+}
+
+void test_short_write_is_truncated() {
+  checkShortWrite(true);
+}
+
+void test_short_write_forces_rewrite_when_truncate_fails() {
+  checkShortWrite(false);
+}
+
+void test_oversized_table_is_not_written() {
+  LittleFS.files.clear();
+  PresetJournal journal;
+  std::vector<Preset> table;
+  String longName;
+  for (int i = 0; i < 200; i++) {
+    longName += 'x';
+  }
+  while (table.size() * (6 + longName.length()) <= PRESET_TABLE_MAX_BYTES) {
+    table.push_back(Preset(longName, PRESET_CLOCK));
+  }
+  TEST_ASSERT_FALSE(journal.commitSnapshot(table));
+  TEST_ASSERT_FALSE(LittleFS.exists(PRESET_JOURNAL_PATH));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_intact_log_recovers_last_commit);
+  RUN_TEST(test_truncation_at_every_offset);
+  RUN_TEST(test_corruption_at_every_offset);
+  RUN_TEST(test_recovered_tail_is_rewritten);
+  RUN_TEST(test_torn_first_save_is_discarded);
+  RUN_TEST(test_short_write_is_truncated);
+  RUN_TEST(test_short_write_forces_rewrite_when_truncate_fails);
+  RUN_TEST(test_oversized_table_is_not_written);
+  return UNITY_END();
+}
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Build the flash-resident station index from tools/stations.txt.
+
+Names are sorted case-insensitively and front-coded: each entry stores
+how many leading bytes it shares with the previous name, then the rest.
+Every STATION_INDEX_BUCKET_SIZE entries the sharing restarts at zero so
+lib/Data/StationIndex.cpp can binary-search the bucket heads and decode
+at most one bucket before reaching the first match.
+
+    entry   u8 shared  u8 suffixLength  suffix[]
+
+Runs as a PlatformIO pre-build script (regenerating only when the list
+changed) or standalone: python3 tools/gen_station_index.py
+"""
+
+import os
+import sys
+
+BUCKET_SIZE = 16
+NAME_MAX = 32
+
+try:
+    Import("env")  # noqa: F821 - defined when run by PlatformIO
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "tools", "stations.txt")
+OUTPUT = os.path.join(PROJECT_DIR, "lib", "Data", "StationIndexData.h")
+
+
+def read_names(path):
+    names = {}
+    with open(path, encoding="ascii") as f:
+        for number, line in enumerate(f, 1):
+            name = line.strip()
+            if not name or name.startswith("#"):
+                continue
+            if len(name) > NAME_MAX:
+                sys.exit("%s:%d: '%s' is longer than %d characters" % (path, number, name, NAME_MAX))
+            names.setdefault(name.lower(), name)  # Same key the firmware compares
+    return [names[key] for key in sorted(names)]
+
+
+def shared_prefix(a, b):
+    n = 0
+    while n < min(len(a), len(b)) and a[n] == b[n]:
+        n += 1
+    return n
+
+
+def encode(names):
+    blob = bytearray()
+    buckets = []
+    previous = ""
+    for i, name in enumerate(names):
+        if i % BUCKET_SIZE == 0:
+            buckets.append(len(blob))
+            shared = 0
+        else:
+            shared = shared_prefix(previous, name)
+        suffix = name[shared:].encode("ascii")
+        blob += bytes([shared, len(suffix)]) + suffix
+        previous = name
+    return blob, buckets
+
+
+def render(names, blob, buckets):
+    raw = sum(len(name) + 1 for name in names)
+    lines = [
+        "// Generated by tools/gen_station_index.py from tools/stations.txt - do not edit",
+        "// %d stations, %d bytes front-coded (%d bytes as plain strings)" % (len(names), len(blob), raw),
+        "",
+        "#ifndef STATIONINDEXDATA_H",
+        "#define STATIONINDEXDATA_H",
+        "",
+        "#define STATION_INDEX_COUNT %d" % len(names),
+        "#define STATION_INDEX_BUCKET_SIZE %d" % BUCKET_SIZE,
+        "#define STATION_INDEX_BUCKET_COUNT %d" % len(buckets),
+        "#define STATION_INDEX_NAME_MAX %d" % NAME_MAX,
+        "",
+        "static const uint8_t STATION_INDEX_BLOB[] PROGMEM = {",
+    ]
+    for i in range(0, len(blob), 16):
+        lines.append("  " + " ".join("0x%02x," % b for b in blob[i:i + 16]))
+    lines += [
+        "};",
+        "",
+        "static const uint16_t STATION_INDEX_BUCKETS[] PROGMEM = {",
+    ]
+    for i in range(0, len(buckets), 8):
+        lines.append("  " + " ".join("%d," % offset for offset in buckets[i:i + 8]))
+    lines += [
+        "};",
+        "",
+        "#endif // STATIONINDEXDATA_H",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def generate(force=False):
+    if not force and os.path.exists(OUTPUT) and os.path.getmtime(OUTPUT) >= os.path.getmtime(SOURCE):
+        return
+    names = read_names(SOURCE)
+    blob, buckets = encode(names)
+    if len(blob) > 0xFFFF:
+        sys.exit("Station index too large for 16-bit bucket offsets")
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write(render(names, blob, buckets))
+    print("Station index: %d stations, %d bytes -> %s" % (len(names), len(blob), os.path.relpath(OUTPUT, PROJECT_DIR)))
+
+
+generate(force=__name__ == "__main__")
@@ -0,0 +1,64 @@
+# PlatformIO post-build script: report how much RAM the flash-resident
+# (PROGMEM) tables and F() strings save, and what DRAM is left in use.
+#
+# On the ESP8266 every initialized constant without PROGMEM is copied to
+# DRAM at boot, so each byte listed here is a byte of heap freed.
+
+Import("env")
+
+import re
+import subprocess
+
+DRAM_START = 0x3FFE8000
+DRAM_END = 0x40000000
+FLASH_START = 0x40200000
+
+# Named tables moved to flash; F()/PSTR() literals are summed separately
+TRACKED_TABLES = ("KEYBOARD_CHARS", "STATION_CHARS", "DEFAULT_PRESETS")
+# Tables that were never in RAM - new flash usage, not savings
+FLASH_ONLY_TABLES = ("STATION_INDEX_BLOB", "STATION_INDEX_BUCKETS")
+FLASH_STRING = re.compile(r"__pstr__|__c(_\d+)?$")
+
+
+def read_symbols(elf):
+    nm = env.subst("$CC").replace("gcc", "nm")
+    output = subprocess.check_output([nm, "--print-size", "--size-sort", "--demangle", elf],
+                                     universal_newlines=True)
+    for line in output.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4:
+            yield int(parts[0], 16), int(parts[1], 16), parts[3]
+
+
+def report(source, target, env):
+    elf = str(target[0])
+    tables = {}
+    flash_strings = 0
+    flash_string_count = 0
+    dram = 0
+
+    for address, size, name in read_symbols(elf):
+        if DRAM_START <= address < DRAM_END:
+            dram += size
+        elif address >= FLASH_START:
+            short = name.rsplit("::", 1)[-1]
+            if short in TRACKED_TABLES or short in FLASH_ONLY_TABLES:
+                tables[short] = tables.get(short, 0) + size
+            elif FLASH_STRING.search(short):
+                flash_strings += size
+                flash_string_count += 1
+
+    print("")
+    print("===== RAM moved to flash =====")
+    for name in TRACKED_TABLES:
+        print("  %-18s %6d bytes" % (name, tables.get(name, 0)))
+    print("  %-18s %6d bytes (%d strings)" % ("F()/PSTR literals", flash_strings, flash_string_count))
+    print("  %-18s %6d bytes" % ("total freed", sum(tables.get(name, 0) for name in TRACKED_TABLES) + flash_strings))
+    print("  DRAM symbols       %6d bytes" % dram)
+    print("===== New flash data =====")
+    for name in FLASH_ONLY_TABLES:
+        print("  %-18s %6d bytes" % (name, tables.get(name, 0)))
+    print("==============================")
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", report)
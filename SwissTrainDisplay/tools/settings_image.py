@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+"""Read and write Swiss Train Display settings images.
+
+The format is the one printed by the "export" console command and accepted
+by "import" (see lib/Storage/SettingsImage.h):
+
+    settings_image.py decode image.txt > settings.json
+    settings_image.py encode settings.json > image.txt
+    settings_image.py roundtrip image.txt
+    settings_image.py pull /dev/ttyUSB0 > image.txt     (needs pyserial)
+    settings_image.py push /dev/ttyUSB0 image.txt
+
+push sends one line at a time and waits for the device's "ACK" before the
+next, so a device busy fetching or writing flash never overruns its serial
+buffer. The last line is answered with "OK ..." or "ERROR: ..." instead.
+"""
+
+import argparse
+import base64
+import json
+import struct
+import sys
+import time
+import zlib
+
+IMAGE_MAGIC = 0x49445453   # "STDI"
+IMAGE_VERSION = 1
+IMAGE_FLAG_WIFI = 0x01
+IMAGE_CHUNK_BYTES = 72
+
+TABLE_MAGIC = 0x50445453   # "STDP"
+TABLE_VERSION = 1
+TABLE_HEADER_SIZE = 16
+PRESET_FLAG_ENABLED = 0x01
+
+PRESET_TYPES = ["train", "clock", "weather", "calendar"]
+
+
+class ImageError(Exception):
+    pass
+
+
+# ====== BODY ======
+
+def put_string(out, text):
+    data = text.encode("utf-8")[:255]
+    out.append(len(data))
+    out.extend(data)
+
+
+def get_string(body, pos):
+    if pos >= len(body) or pos + 1 + body[pos] > len(body):
+        raise ImageError("string runs past end of image")
+    length = body[pos]
+    return body[pos + 1:pos + 1 + length].decode("utf-8", "replace"), pos + 1 + length
+
+
+def encode_body(settings):
+    presets = settings["presets"]
+    records = bytearray()
+    for preset in presets:
+        records.append(PRESET_TYPES.index(preset.get("type", "train")))
+        records.append(PRESET_FLAG_ENABLED if preset.get("enabled", True) else 0)
+        records.append(preset.get("trainsToDisplay", 1))
+        put_string(records, preset.get("name", ""))
+        put_string(records, preset.get("from", ""))
+        put_string(records, preset.get("to", ""))
+
+    wifi = settings.get("wifi")
+    body = bytearray(struct.pack("<IBBH", IMAGE_MAGIC, IMAGE_VERSION,
+                                 IMAGE_FLAG_WIFI if wifi else 0, settings.get("current", 0)))
+    put_string(body, wifi["ssid"] if wifi else "")
+    put_string(body, wifi["password"] if wifi else "")
+    body += struct.pack("<IBBHII", TABLE_MAGIC, TABLE_VERSION, TABLE_HEADER_SIZE,
+                        len(presets), len(records), zlib.crc32(records))
+    body += records
+    return bytes(body)
+
+
+def decode_body(body):
+    if len(body) < 8:
+        raise ImageError("image too short")
+    magic, version, flags, current = struct.unpack_from("<IBBH", body, 0)
+    if magic != IMAGE_MAGIC or version != IMAGE_VERSION:
+        raise ImageError("not a settings image")
+    ssid, pos = get_string(body, 8)
+    password, pos = get_string(body, pos)
+
+    if len(body) - pos < TABLE_HEADER_SIZE:
+        raise ImageError("preset table missing")
+    magic, version, header_size, count, size, crc = struct.unpack_from("<IBBHII", body, pos)
+    if magic != TABLE_MAGIC or version != TABLE_VERSION or header_size != TABLE_HEADER_SIZE:
+        raise ImageError("preset table header invalid")
+    records = body[pos + TABLE_HEADER_SIZE:pos + TABLE_HEADER_SIZE + size]
+    if len(records) != size or zlib.crc32(records) != crc:
+        raise ImageError("preset table CRC mismatch")
+
+    presets = []
+    pos = 0
+    for _ in range(count):
+        if pos + 3 > len(records):
+            raise ImageError("preset record truncated")
+        kind, preset_flags, trains = records[pos:pos + 3]
+        name, pos = get_string(records, pos + 3)
+        origin, pos = get_string(records, pos)
+        destination, pos = get_string(records, pos)
+        presets.append({
+            "name": name,
+            "from": origin,
+            "to": destination,
+            "type": PRESET_TYPES[kind] if kind < len(PRESET_TYPES) else kind,
+            "enabled": bool(preset_flags & PRESET_FLAG_ENABLED),
+            "trainsToDisplay": trains,
+        })
+
+    settings = {"current": current, "presets": presets}
+    if flags & IMAGE_FLAG_WIFI:
+        settings["wifi"] = {"ssid": ssid, "password": password}
+    return settings
+
+
+# ====== FRAMING ======
+
+def write_image(body):
+    lines = ["STDIMG %d %d %08x" % (IMAGE_VERSION, len(body), zlib.crc32(body))]
+    for i in range(0, len(body), IMAGE_CHUNK_BYTES):
+        lines.append("D " + base64.b64encode(body[i:i + IMAGE_CHUNK_BYTES]).decode("ascii"))
+    lines.append("END")
+    return "\n".join(lines) + "\n"
+
+
+def read_image(text):
+    lines = [line.strip() for line in text.splitlines() if line.strip()]
+    start = next((i for i, line in enumerate(lines) if line.startswith("STDIMG ")), None)
+    if start is None:
+        raise ImageError("no STDIMG header")
+    _, version, size, crc = lines[start].split()
+    if int(version) != IMAGE_VERSION:
+        raise ImageError("unsupported image version " + version)
+
+    body = bytearray()
+    for line in lines[start + 1:]:
+        if line == "END":
+            break
+        if not line.startswith("D "):
+            raise ImageError("unexpected line: " + line)
+        body += base64.b64decode(line[2:], validate=True)
+    else:
+        raise ImageError("image has no END line")
+
+    if len(body) != int(size):
+        raise ImageError("image truncated: %d/%s bytes" % (len(body), size))
+    if zlib.crc32(body) != int(crc, 16):
+        raise ImageError("image CRC mismatch")
+    return bytes(body)
+
+
+# ====== SERIAL ======
+
+def open_port(port, baud):
+    try:
+        import serial
+    except ImportError:
+        raise ImageError("pull/push need pyserial (pip install pyserial)")
+    return serial.Serial(port, baud, timeout=5)
+
+
+def read_reply(link, prefixes):
+    deadline = time.time() + 10
+    while time.time() < deadline:
+        line = link.readline().decode("ascii", "replace").strip()
+        if line.startswith(prefixes):
+            return line
+    raise ImageError("no reply from device")
+
+
+def pull(port, baud, presets_only):
+    with open_port(port, baud) as link:
+        link.reset_input_buffer()
+        link.write(b"export presets\n" if presets_only else b"export\n")
+        lines = [read_reply(link, ("STDIMG", "ERROR"))]
+        if lines[0].startswith("ERROR"):
+            raise ImageError(lines[0])
+        while lines[-1] != "END":
+            lines.append(read_reply(link, ("D ", "END")))
+    return "\n".join(lines) + "\n"
+
+
+def push(port, baud, text):
+    # Refuse to send a broken image; resending the framing drops stray lines
+    lines = write_image(read_image(text)).splitlines()
+    with open_port(port, baud) as link:
+        link.reset_input_buffer()
+        link.write(b"import\n")
+        read_reply(link, ("READY",))
+        for line in lines[:-1]:
+            link.write(line.encode("ascii") + b"\n")
+            reply = read_reply(link, ("ACK", "ERROR"))
+            if reply.startswith("ERROR"):
+                raise ImageError(reply)
+        link.write(lines[-1].encode("ascii") + b"\n")
+        return read_reply(link, ("OK", "ERROR"))
+
+
+# ====== COMMANDS ======
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+    sub.add_parser("decode", help="image -> JSON").add_argument("image")
+    sub.add_parser("encode", help="JSON -> image").add_argument("json")
+    sub.add_parser("roundtrip", help="check decode/encode reproduces the image").add_argument("image")
+    pull_cmd = sub.add_parser("pull", help="export from a device")
+    pull_cmd.add_argument("port")
+    pull_cmd.add_argument("--presets-only", action="store_true", help="leave WiFi credentials out")
+    push_cmd = sub.add_parser("push", help="import into a device")
+    push_cmd.add_argument("port")
+    push_cmd.add_argument("image")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    try:
+        if args.command == "decode":
+            with open(args.image) as f:
+                json.dump(decode_body(read_image(f.read())), sys.stdout, indent=2)
+            print()
+        elif args.command == "encode":
+            with open(args.json) as f:
+                sys.stdout.write(write_image(encode_body(json.load(f))))
+        elif args.command == "roundtrip":
+            with open(args.image) as f:
+                body = read_image(f.read())
+            again = encode_body(decode_body(body))
+            if again != body:
+                raise ImageError("re-encoded image differs (%d vs %d bytes)" % (len(again), len(body)))
+            print("OK %d bytes" % len(body))
+        elif args.command == "pull":
+            sys.stdout.write(pull(args.port, args.baud, args.presets_only))
+        elif args.command == "push":
+            with open(args.image) as f:
+                print(push(args.port, args.baud, f.read()))
+    except (ImageError, ValueError, OSError) as e:
+        print("ERROR: %s" % e, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())